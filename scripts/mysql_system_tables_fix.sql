@@ -773,3 +773,7 @@ ALTER TABLE help_topic MODIFY url TEXT NOT NULL;
 
 # MDEV-7383 - varbinary on mix/max of column_stats
 alter table column_stats modify min_value varbinary(255) DEFAULT NULL, modify max_value varbinary(255) DEFAULT NULL;
+
+# Histograms with the most common values
+alter table column_stats modify hist_type enum('SINGLE_PREC_HB','DOUBLE_PREC_HB','MCV_HB');
+alter table column_stats modify histogram blob;
@@ -193,6 +193,7 @@ SORT_INFO *filesort(THD *thd, TABLE *table, Filesort *filesort,
                           table,
                           thd->variables.max_length_for_sort_data,
                           max_rows, filesort->sort_positions);
+  param.sort_threads= (uint) thd->variables.filesort_threads;
 
   sort->addon_buf=    param.addon_buf;
   sort->addon_field=  param.addon_field;
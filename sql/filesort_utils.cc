@@ -18,6 +18,8 @@
 #include "sql_const.h"
 #include "sql_sort.h"
 #include "table.h"
+#include "mysqld.h"
+#include <myisampack.h>
 
 
 namespace {
@@ -157,13 +159,215 @@ void Filesort_buffer::free_sort_buffer()
 }
 
 
+namespace {
+/**
+  A part of the sort buffer that is sorted, or a pair of sorted parts
+  that are merged, by one thread.
+*/
+struct Sort_part
+{
+  uchar **keys;                    /* The keys of the part */
+  uint count;                      /* The number of keys in the part */
+  uint count2;                     /* The number of keys in the next part */
+  uchar **to;                      /* Scratch or merge output, count+count2 */
+  size_t sort_length;
+};
+
+
+/**
+  Compare two sort keys. The keys are compared as a fixed-width big-endian
+  8-byte prefix, which the compiler turns into a single load, byte swap
+  and integer compare, and by memcmp() of the rest only if the prefixes
+  are equal.
+*/
+inline int cmp_sort_keys(const uchar *a, const uchar *b, size_t length)
+{
+  if (length >= 8)
+  {
+    ulonglong x= mi_uint8korr(a), y= mi_uint8korr(b);
+    if (x != y)
+      return x < y ? -1 : 1;
+    return memcmp(a + 8, b + 8, length - 8);
+  }
+  return memcmp(a, b, length);
+}
+
+
+void sort_part(uchar **keys, uint count, size_t size, uchar **buffer)
+{
+  if (count <= 1)
+    return;
+  if (buffer && radixsort_is_appliccable(count, size))
+    radixsort_for_str_ptr(keys, count, size, buffer);
+  else
+    my_qsort2(keys, count, sizeof(uchar*), get_ptr_compare(size), &size);
+}
+
+
+void *sort_part_thread(void *arg)
+{
+  Sort_part *part= static_cast<Sort_part*>(arg);
+  sort_part(part->keys, part->count, part->sort_length, part->to);
+  return NULL;
+}
+
+
+/** Merge two adjacent sorted parts of keys into part->to */
+void *merge_parts_thread(void *arg)
+{
+  Sort_part *part= static_cast<Sort_part*>(arg);
+  uchar **a= part->keys, **a_end= a + part->count;
+  uchar **b= a_end, **b_end= b + part->count2;
+  uchar **to= part->to;
+  while (a < a_end && b < b_end)
+    *to++= cmp_sort_keys(*b, *a, part->sort_length) < 0 ? *b++ : *a++;
+  while (a < a_end)
+    *to++= *a++;
+  while (b < b_end)
+    *to++= *b++;
+  return NULL;
+}
+
+
+/** The number of threads that the filesorts of the server run now */
+int32 n_sort_helpers;
+
+
+/**
+  Reserve up to n_wanted threads within filesort_max_threads
+
+  @return the number of threads reserved, to be released with
+          release_sort_helpers()
+*/
+uint reserve_sort_helpers(uint n_wanted)
+{
+  int32 n= my_atomic_load32(&n_sort_helpers);
+  for (;;)
+  {
+    int32 max= (int32) filesort_max_threads;
+    if (n >= max)
+      return 0;
+    int32 n_reserved= (int32) MY_MIN(n_wanted, (uint) (max - n));
+    if (my_atomic_cas32(&n_sort_helpers, &n, n + n_reserved))
+      return (uint) n_reserved;
+  }
+}
+
+
+void release_sort_helpers(uint n)
+{
+  if (n)
+    my_atomic_add32(&n_sort_helpers, -(int32) n);
+}
+
+
+/**
+  Run func on each of the n parts, the first one on the calling thread and
+  the others on threads of their own. A part for which no thread can be
+  created is processed by the calling thread.
+*/
+void run_on_threads(void *(*func)(void *), Sort_part *parts, uint n)
+{
+  pthread_t threads[MAX_FILESORT_THREADS];
+  bool started[MAX_FILESORT_THREADS];
+  for (uint i= 1; i < n; i++)
+    started[i]= !mysql_thread_create(0, &threads[i], NULL, func, &parts[i]);
+  func(&parts[0]);
+  for (uint i= 1; i < n; i++)
+  {
+    if (started[i])
+      pthread_join(threads[i], NULL);
+    else
+      func(&parts[i]);
+  }
+}
+} // namespace
+
+
+/**
+  Sort the keys of the buffer
+
+  @param param  sort parameters
+  @param count  the number of keys
+
+  With filesort_threads > 1 and enough keys, the keys are split into
+  parts that are sorted on separate threads. The threads beyond the
+  connection thread are taken from the server-wide filesort_max_threads,
+  so a sort gets fewer parts, or just one, when other sorts use them. The sorted parts are then
+  merged pairwise, the merges of one round again running in parallel,
+  until one sorted sequence is left.
+*/
+
 void Filesort_buffer::sort_buffer(const Sort_param *param, uint count)
 {
   size_t size= param->sort_length;
   if (count <= 1 || size == 0)
     return;
   uchar **keys= get_sort_keys();
+  uint n_parts= MY_MIN(param->sort_threads, count / FILESORT_MIN_KEYS_PER_THREAD);
+  uint n_helpers= n_parts > 1 ? reserve_sort_helpers(n_parts - 1) : 0;
   uchar **buffer= NULL;
+
+  n_parts= n_helpers + 1;
+
+  if (n_parts > 1 &&
+      (buffer= (uchar**) my_malloc(count*sizeof(char*),
+                                   MYF(MY_THREAD_SPECIFIC))))
+  {
+    Sort_part parts[MAX_FILESORT_THREADS];
+    uint part_size= count / n_parts;
+    uchar **from= keys, **to= buffer;
+
+    for (uint i= 0; i < n_parts; i++)
+    {
+      parts[i].keys= keys + i * part_size;
+      parts[i].count= i == n_parts - 1 ? count - i * part_size : part_size;
+      parts[i].to= buffer + i * part_size;
+      parts[i].sort_length= size;
+    }
+    run_on_threads(sort_part_thread, parts, n_parts);
+
+    while (n_parts > 1)
+    {
+      Sort_part merges[MAX_FILESORT_THREADS];
+      uint n_merges= n_parts / 2;
+      for (uint i= 0; i < n_merges; i++)
+      {
+        merges[i].keys= parts[2 * i].keys;
+        merges[i].count= parts[2 * i].count;
+        merges[i].count2= parts[2 * i + 1].count;
+        merges[i].to= to + (parts[2 * i].keys - from);
+        merges[i].sort_length= size;
+      }
+      run_on_threads(merge_parts_thread, merges, n_merges);
+
+      /* An odd part out is moved to the output as is */
+      if (n_parts & 1)
+      {
+        Sort_part *last= &parts[n_parts - 1];
+        memcpy(to + (last->keys - from), last->keys,
+               last->count * sizeof(uchar*));
+        merges[n_merges].keys= to + (last->keys - from);
+        merges[n_merges].count= last->count;
+        n_merges++;
+      }
+      for (uint i= 0; i < n_merges; i++)
+      {
+        parts[i].keys= i < n_parts / 2 ? merges[i].to : merges[i].keys;
+        parts[i].count= i < n_parts / 2 ?
+                        merges[i].count + merges[i].count2 : merges[i].count;
+      }
+      n_parts= n_merges;
+      swap_variables(uchar **, from, to);
+    }
+    if (from != keys)
+      memcpy(keys, from, count * sizeof(uchar*));
+    my_free(buffer);
+    release_sort_helpers(n_helpers);
+    return;
+  }
+  release_sort_helpers(n_helpers);
+
   if (radixsort_is_appliccable(count, param->sort_length) &&
       (buffer= (uchar**) my_malloc(count*sizeof(char*),
                                    MYF(MY_THREAD_SPECIFIC))))
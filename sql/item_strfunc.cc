@@ -472,12 +472,12 @@ String *Item_func_from_base64::val_str(String *str)
 
 
 const char *histogram_types[] =
-           {"SINGLE_PREC_HB", "DOUBLE_PREC_HB", 0};
+           {"SINGLE_PREC_HB", "DOUBLE_PREC_HB", "MCV_HB", 0};
 static TYPELIB hystorgam_types_typelib=
   { array_elements(histogram_types),
     "histogram_types",
     histogram_types, NULL};
-const char *representation_by_type[]= {"%.3f", "%.5f"};
+const char *representation_by_type[]= {"%.3f", "%.5f", "%.5f"};
 
 String *Item_func_decode_histogram::val_str(String *str)
 {
@@ -510,6 +510,8 @@ String *Item_func_decode_histogram::val_str(String *str)
   str->length(0);
   char numbuf[32];
   const uchar *p= (uchar*)res->c_ptr_safe();
+  if (type == MCV_HB)
+    return decode_mcv_histogram(str, p, res->length());
   for (i= 0; i < res->length(); i++)
   {
     double val;
@@ -543,6 +545,53 @@ String *Item_func_decode_histogram::val_str(String *str)
 }
 
 
+
+/*
+  Decode a histogram of the type MCV_HB: each most common value is shown
+  as "=position:share", each bucket as "delta:share:distinct", where
+  delta is the difference of the bucket end with the previous one. The
+  texts of the most common values and of the bucket ends that follow the
+  histogram are not shown.
+*/
+
+String *Item_func_decode_histogram::decode_mcv_histogram(String *str,
+                                                         const uchar *p,
+                                                         uint length)
+{
+  const double prec= (double) ((1 << 16) - 1);
+  char numbuf[64];
+  size_t size;
+  if (length < 2 || 2 + p[0] * 4U + p[1] * 5U > length)
+  {
+    null_value= 1;
+    return 0;
+  }
+  uint n_values= p[0], n_buckets= p[1];
+  const uchar *ptr= p + 2;
+  for (uint i= 0; i < n_values; i++, ptr+= 4)
+  {
+    size= my_snprintf(numbuf, sizeof(numbuf), "=%.5f:%.5f,",
+                      uint2korr(ptr) / prec, uint2korr(ptr + 2) / prec);
+    str->append(numbuf, size);
+  }
+  double prev= 0.0;
+  for (uint i= 0; i < n_buckets; i++, ptr+= 5)
+  {
+    double val= uint2korr(ptr) / prec;
+    size= my_snprintf(numbuf, sizeof(numbuf), "%.5f:%.5f:%u,",
+                      val - prev, uint2korr(ptr + 2) / prec, (uint) ptr[4]);
+    str->append(numbuf, size);
+    prev= val;
+  }
+  /* show delta with max */
+  size= my_snprintf(numbuf, sizeof(numbuf), "%.5f", 1.0 - prev);
+  str->append(numbuf, size);
+
+  null_value= 0;
+  return str;
+}
+
+
 ///////////////////////////////////////////////////////////////////////////////
 
 /*
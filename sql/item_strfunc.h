@@ -290,6 +290,7 @@ class Item_func_concat_operator_oracle :public Item_func_concat
 
 class Item_func_decode_histogram :public Item_str_func
 {
+  String *decode_mcv_histogram(String *str, const uchar *p, uint length);
 public:
   Item_func_decode_histogram(THD *thd, Item *a, Item *b):
     Item_str_func(thd, a, b) {}
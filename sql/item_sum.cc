@@ -2285,6 +2285,143 @@ void Item_sum_hybrid::clear()
   DBUG_ENTER("Item_sum_hybrid::clear");
   value->clear();
   null_value= 1;
+  window_head= window_tail= 0;
+  window_added= window_removed= 0;
+  DBUG_VOID_RETURN;
+}
+
+
+/**
+  Add the current row to the window frame
+
+  @details
+    The values at the end of the deque that are not better than the new
+    one can never become the result again: they leave the frame before
+    the new one. They are dropped before the new value is appended, so
+    that every row is appended and dropped at most once.
+
+  @retval false  ok
+  @retval true   out of memory
+*/
+
+bool Item_sum_hybrid::window_add()
+{
+  ulonglong row= ++window_added;
+  Item_cache *save_value= value;
+
+  arg_cache->cache_value();
+  if (arg_cache->null_value || row <= window_removed)
+    return false;
+
+  /* cmp compares arg_cache with whatever value points to */
+  while (window_tail > window_head)
+  {
+    value= window_values[window_tail - 1];
+    if (cmp->compare() * cmp_sign > 0)
+      break;
+    window_tail--;
+  }
+  value= save_value;
+
+  if (window_tail == window_alloced && window_grow())
+    return true;
+  window_values[window_tail]->store(arg_cache);
+  window_values[window_tail]->cache_value();
+  window_rows[window_tail++]= row;
+  window_update_value();
+  return false;
+}
+
+
+/**
+  Make room at the end of the deque, by moving it to the start of the
+  array if at least half of the array is free there, or else by doubling
+  the array.
+*/
+
+bool Item_sum_hybrid::window_grow()
+{
+  if (window_head && window_head >= window_alloced / 2)
+  {
+    for (uint i= window_head; i < window_tail; i++)
+    {
+      swap_variables(Item_cache *, window_values[i - window_head],
+                     window_values[i]);
+      window_rows[i - window_head]= window_rows[i];
+    }
+    window_tail-= window_head;
+    window_head= 0;
+    return false;
+  }
+
+  THD *thd= current_thd;
+  uint alloced= window_alloced ? window_alloced * 2 : 16;
+  Item_cache **values;
+  ulonglong *rows;
+  if (!(values= (Item_cache **) my_realloc(window_values,
+                                           alloced * sizeof(Item_cache *),
+                                           MYF(MY_WME | MY_ALLOW_ZERO_PTR))))
+    return true;
+  window_values= values;
+  if (!(rows= (ulonglong *) my_realloc(window_rows,
+                                       alloced * sizeof(ulonglong),
+                                       MYF(MY_WME | MY_ALLOW_ZERO_PTR))))
+    return true;
+  window_rows= rows;
+  for (uint i= window_alloced; i < alloced; i++)
+  {
+    if (!(values[i]= args[0]->get_cache(thd)))
+      return true;
+    values[i]->setup(thd, args[0]);
+    values[i]->set_used_tables(RAND_TABLE_BIT);
+    window_alloced= i + 1;
+  }
+  return false;
+}
+
+
+void Item_sum_hybrid::window_update_value()
+{
+  if (window_head == window_tail)
+  {
+    value->clear();
+    null_value= 1;
+    return;
+  }
+  value->store(window_values[window_head]);
+  value->cache_value();
+  null_value= 0;
+}
+
+
+/**
+  Check whether the window frame can lose rows, i.e. whether it does not
+  start at UNBOUNDED PRECEDING. Without a frame clause it does.
+*/
+
+void Item_sum_hybrid::setup_window_func(THD *thd, Window_spec *window_spec)
+{
+  Window_frame *frame= window_spec->window_frame;
+  window_frame_removes=
+    frame && !(frame->top_bound->precedence_type ==
+               Window_frame_bound::PRECEDING &&
+               frame->top_bound->is_unbounded());
+}
+
+
+/**
+  Remove the oldest row from the window frame
+*/
+
+void Item_sum_hybrid::remove()
+{
+  DBUG_ENTER("Item_sum_hybrid::remove");
+  window_removed++;
+  if (window_head < window_tail && window_rows[window_head] <= window_removed)
+  {
+    window_head++;
+    window_update_value();
+  }
   DBUG_VOID_RETURN;
 }
 
@@ -2371,6 +2508,12 @@ void Item_sum_hybrid::cleanup()
   if (cmp)
     delete cmp;
   cmp= 0;
+  my_free(window_values);
+  my_free(window_rows);
+  window_values= 0;
+  window_rows= 0;
+  window_head= window_tail= window_alloced= 0;
+  window_added= window_removed= 0;
   /*
     by default it is TRUE to avoid TRUE reporting by
     Item_func_not_all/Item_func_nop_all if this item was never called.
@@ -2420,6 +2563,9 @@ bool Item_sum_min::add()
   DBUG_ENTER("Item_sum_min::add");
   DBUG_PRINT("enter", ("this: %p", this));
 
+  if (window_frame_removes)
+    DBUG_RETURN(window_add());
+
   if (unlikely(direct_added))
   {
     /* Change to use direct_item */
@@ -2460,6 +2606,9 @@ bool Item_sum_max::add()
   DBUG_ENTER("Item_sum_max::add");
   DBUG_PRINT("enter", ("this: %p", this));
 
+  if (window_frame_removes)
+    DBUG_RETURN(window_add());
+
   if (unlikely(direct_added))
   {
     /* Change to use direct_item */
@@ -575,7 +575,7 @@ class Item_sum :public Item_func_or_sum
   bool check_vcol_func_processor(void *arg);
   virtual void setup_window_func(THD *thd, Window_spec *window_spec) {}
   void mark_as_window_func_sum_expr() { window_func_sum_expr_flag= true; }
-  bool is_window_func_sum_expr() { return window_func_sum_expr_flag; }
+  bool is_window_func_sum_expr() const { return window_func_sum_expr_flag; }
   virtual void setup_caches(THD *thd) {};
 };
 
@@ -1037,19 +1037,43 @@ class Item_sum_hybrid :public Item_sum, public Type_handler_hybrid_field_type
   int cmp_sign;
   bool was_values;  // Set if we have found at least one row (for max/min only)
   bool was_null_value;
+  /*
+    For a window function: the values of the rows in the frame that can
+    still become the result as rows are removed from the frame, in the
+    order the rows were added. Every value is better than all the values
+    after it, so the result is the first one (a monotonic deque).
+  */
+  Item_cache **window_values;
+  ulonglong *window_rows;       // The number of the row of each value
+  uint window_head, window_tail, window_alloced;
+  ulonglong window_added, window_removed;
+  /*
+    TRUE if the window frame can lose rows. A frame that only grows does
+    not need the deque: add() keeps just the best value, as in GROUP BY.
+  */
+  bool window_frame_removes;
+
+  bool window_add();
+  bool window_grow();
+  void window_update_value();
 
   public:
   Item_sum_hybrid(THD *thd, Item *item_par,int sign):
     Item_sum(thd, item_par),
     Type_handler_hybrid_field_type(&type_handler_longlong),
     direct_added(FALSE), value(0), arg_cache(0), cmp(0),
-    cmp_sign(sign), was_values(TRUE)
+    cmp_sign(sign), was_values(TRUE), window_values(0), window_rows(0),
+    window_head(0), window_tail(0), window_alloced(0),
+    window_added(0), window_removed(0), window_frame_removes(FALSE)
   { collation.set(&my_charset_bin); }
   Item_sum_hybrid(THD *thd, Item_sum_hybrid *item)
     :Item_sum(thd, item),
     Type_handler_hybrid_field_type(item),
     direct_added(FALSE), value(item->value), arg_cache(0),
-    cmp_sign(item->cmp_sign), was_values(item->was_values)
+    cmp_sign(item->cmp_sign), was_values(item->was_values),
+    window_values(0), window_rows(0), window_head(0), window_tail(0),
+    window_alloced(0), window_added(0), window_removed(0),
+    window_frame_removes(item->window_frame_removes)
   { }
   bool fix_fields(THD *, Item **);
   void fix_length_and_dec();
@@ -1080,6 +1104,13 @@ class Item_sum_hybrid :public Item_sum, public Type_handler_hybrid_field_type
   void restore_to_before_no_rows_in_result();
   Field *create_tmp_field(bool group, TABLE *table);
   void setup_caches(THD *thd) { setup_hybrid(thd, arguments()[0], NULL); }
+  /*
+    The rows leave a window frame in the order they were added, which is
+    all that remove() needs.
+  */
+  bool supports_removal() const { return is_window_func_sum_expr(); }
+  void remove();
+  void setup_window_func(THD *thd, Window_spec *window_spec);
 };
 
 
@@ -227,7 +227,9 @@ extern int32 slave_open_temp_tables;
 extern ulonglong query_cache_size;
 extern ulong query_cache_limit;
 extern ulong query_cache_min_res_unit;
+extern my_bool opt_query_cache_lazy_invalidation;
 extern ulong slow_launch_threads, slow_launch_time;
+extern ulong filesort_max_threads;
 extern MYSQL_PLUGIN_IMPORT ulong max_connections;
 extern uint max_digest_length;
 extern ulong max_connect_errors, connect_timeout;
@@ -1292,6 +1292,8 @@ Query_cache::Query_cache(size_t query_cache_limit_arg,
   set_if_bigger(min_allocation_unit,min_needed);
   this->min_allocation_unit= ALIGN_SIZE(min_allocation_unit);
   set_if_bigger(this->min_result_data_size,min_allocation_unit);
+  bzero(table_generations, sizeof(table_generations));
+  bzero(db_generations, sizeof(db_generations));
 }
 
 
@@ -1529,6 +1531,17 @@ def_week_frmt: %zu, in_trans: %d, autocommit: %d",
     Query_cache_block *competitor = (Query_cache_block *)
       my_hash_search(&queries, (uchar*) query, tot_length);
     DBUG_PRINT("qcache", ("competitor %p", competitor));
+    if (competitor &&
+        competitor->query()->result() != 0 &&
+        competitor->query()->result()->type == Query_cache_block::RESULT &&
+        is_stale(competitor))
+    {
+      /* The result was only marked stale, see invalidate_table() */
+      DBUG_PRINT("qcache", ("competitor is stale"));
+      BLOCK_LOCK_WR(competitor);
+      free_query(competitor);
+      competitor= 0;
+    }
     if (competitor == 0)
     {
       /* Query is not in cache and no one is working with it; Store it */
@@ -2033,6 +2046,20 @@ def_week_frmt: %zu, in_trans: %d, autocommit: %d",
     BLOCK_UNLOCK_RD(query_block);
     goto err_unlock;
   }
+
+  if (is_stale(query_block))
+  {
+    /*
+      A table was changed after the result was stored and the query was
+      left in the cache by query_cache_lazy_invalidation. Nobody else can
+      find the query while we hold structure_guard_mutex.
+    */
+    DBUG_PRINT("qcache", ("query found, but a table was changed since"));
+    BLOCK_UNLOCK_RD(query_block);
+    BLOCK_LOCK_WR(query_block);
+    free_query(query_block);
+    goto err_unlock;
+  }
       
   // Check access;
   THD_STAGE_INFO(thd, stage_checking_privileges_on_cached_query);
@@ -2355,6 +2382,13 @@ void Query_cache::invalidate(THD *thd, const char *db)
 
   DBUG_SLOW_ASSERT(ok_for_lower_case_names(db));
 
+  /* See invalidate_table() */
+  my_atomic_add64(&db_generations[my_hash_sort(&my_charset_bin,
+                                               (const uchar*) db, strlen(db)) %
+                                  QUERY_CACHE_GENERATIONS], 1);
+  if (opt_query_cache_lazy_invalidation)
+    DBUG_VOID_RETURN;
+
   bool restart= FALSE;
   /*
     Lock the query cache and queue all invalidation attempts to avoid
@@ -3308,6 +3342,16 @@ void Query_cache::invalidate_table(THD *thd, uchar * key, size_t key_length)
 {
   DEBUG_SYNC(thd, "wait_in_query_cache_invalidate1");
 
+  /*
+    From now on the cached queries using the table are stale, even if they
+    are not removed below. With query_cache_lazy_invalidation they are left
+    to be removed by the next lookup or when their memory is needed, so that
+    writes never wait for the query cache lock.
+  */
+  invalidate_generation(key, key_length);
+  if (opt_query_cache_lazy_invalidation)
+    return;
+
   /*
     Lock the query cache and queue all invalidation attempts to avoid
     the risk of a race between invalidation, cache inserts and flushes.
@@ -3343,6 +3387,71 @@ Query_cache::invalidate_table_internal(THD *thd, uchar *key, size_t key_length)
   }
 }
 
+/**
+  Compute the invalidation generation of a table.
+
+  @param key         table key: the database name, '\0', the table name, '\0'
+                     and an optional suffix
+  @param key_length  length of the key
+
+  @return the sum of the invalidation counters of the table and of its
+  database. The counters only grow, so any invalidation of either of them
+  changes the sum.
+*/
+
+ulonglong Query_cache::table_generation(const uchar *key, size_t key_length)
+{
+  size_t db_length= strnlen((const char*) key, key_length);
+  return (ulonglong)
+    (my_atomic_load64(&table_generations[my_hash_sort(&my_charset_bin, key,
+                                                      key_length) %
+                                         QUERY_CACHE_GENERATIONS]) +
+     my_atomic_load64(&db_generations[my_hash_sort(&my_charset_bin, key,
+                                                   db_length) %
+                                      QUERY_CACHE_GENERATIONS]));
+}
+
+
+/**
+  Make all cached queries that use a table stale.
+
+  @param key         table key
+  @param key_length  length of the key
+
+  @note structure_guard_mutex need not be held.
+*/
+
+void Query_cache::invalidate_generation(const uchar *key, size_t key_length)
+{
+  my_atomic_add64(&table_generations[my_hash_sort(&my_charset_bin, key,
+                                                  key_length) %
+                                     QUERY_CACHE_GENERATIONS], 1);
+}
+
+
+/**
+  Check whether any table used by a cached query was invalidated after
+  the query was registered.
+
+  @pre structure_guard_mutex is acquired.
+*/
+
+bool Query_cache::is_stale(Query_cache_block *query_block)
+{
+  Query_cache_block_table *block_table= query_block->table(0);
+  Query_cache_block_table *block_table_end=
+    block_table + query_block->n_tables;
+  for (; block_table != block_table_end; block_table++)
+  {
+    Query_cache_table *table= block_table->parent;
+    if (block_table->generation !=
+        table_generation((uchar*) table->db(), table->key_length()))
+      return true;
+  }
+  return false;
+}
+
+
 /**
   Invalidate a linked list of query cache blocks.
 
@@ -3514,8 +3623,14 @@ Query_cache::insert_table(THD *thd, size_t key_len, const char *key,
      (Query_cache_block *) my_hash_search(&tables, (uchar*) key, key_len) :
      NULL);
 
+  /*
+    With query_cache_lazy_invalidation the block of a dropped table can
+    outlive it, so it may describe another table of the same name.
+  */
   if (table_block &&
-      table_block->table()->engine_data() != engine_data)
+      (table_block->table()->engine_data() != engine_data ||
+       table_block->table()->type() != cache_type ||
+       table_block->table()->callback() != callback))
   {
     DBUG_PRINT("qcache",
                ("Handler require invalidation queries of %s.%s %llu-%llu",
@@ -3592,6 +3707,7 @@ Query_cache::insert_table(THD *thd, size_t key_len, const char *key,
     on the cached table.
   */
   Query_cache_block_table *list_root= table_block->table(0);
+  node->generation= table_generation((const uchar*) key, key_len);
   node->next= list_root->next;
   list_root->next= node;
   node->next->prev= node;
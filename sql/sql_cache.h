@@ -40,6 +40,9 @@ typedef struct st_changed_table_list CHANGED_TABLE_LIST;
 #define QUERY_CACHE_DEF_QUERY_HASH_SIZE		1024
 #define QUERY_CACHE_DEF_TABLE_HASH_SIZE		1024
 
+/* number of table and database invalidation counters */
+#define QUERY_CACHE_GENERATIONS			4096
+
 /* minimal result data size when data allocated */
 #define QUERY_CACHE_MIN_RESULT_DATA_SIZE	(1024*4)
 
@@ -111,6 +114,13 @@ struct Query_cache_block_table
   */
   Query_cache_table *parent;
 
+  /**
+    The invalidation counters of the table and of its database, added up,
+    as they were when the query was registered. The cached result is stale
+    once they have changed (see Query_cache::table_generation()).
+  */
+  ulonglong generation;
+
   /**
     A method to calculate the address of the query cache block
     owning this node. The purpose of this calculation is to 
@@ -318,8 +328,19 @@ class Query_cache
   enum Cache_staus {OK, DISABLE_REQUEST, DISABLED};
   Cache_staus m_cache_status;
 
+  /*
+    Invalidation counters, indexed by a hash of the table key or of the
+    database name. They are only ever incremented, without holding
+    structure_guard_mutex.
+  */
+  int64 table_generations[QUERY_CACHE_GENERATIONS];
+  int64 db_generations[QUERY_CACHE_GENERATIONS];
+
   void free_query_internal(Query_cache_block *point);
   void invalidate_table_internal(THD *thd, uchar *key, size_t key_length);
+  ulonglong table_generation(const uchar *key, size_t key_length);
+  void invalidate_generation(const uchar *key, size_t key_length);
+  bool is_stale(Query_cache_block *query_block);
 
 protected:
   /*
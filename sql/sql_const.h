@@ -88,6 +88,9 @@
 
 #define MAX_SORT_MEMORY 2048*1024
 #define MIN_SORT_MEMORY 1024
+#define MAX_FILESORT_THREADS 64
+/* Sort buffers with fewer keys per thread are sorted by one thread */
+#define FILESORT_MIN_KEYS_PER_THREAD 16384
 
 /* Some portable defines */
 
@@ -35,6 +35,11 @@
 
 #define NO_MORE_RECORDS_IN_BUFFER  (uint)(-1)
 
+/* The maximum number of partitions of a join by a BNLH join cache */
+#define JOIN_CACHE_MAX_PARTITIONS  64
+/* The size of the buffer of every partition file */
+#define JOIN_CACHE_PARTITION_BUFFER_SIZE  (IO_SIZE*4)
+
 static void save_or_restore_used_tabs(JOIN_TAB *join_tab, bool save);
 
 /*****************************************************************************
@@ -2610,6 +2615,19 @@ THD *JOIN_CACHE::thd()
 }
 
 
+/*
+  Free the join buffer and the resources kept by the scan of the joined table
+*/
+
+void JOIN_CACHE::free()
+{
+  my_free(buff);
+  buff= 0;
+  if (join_tab_scan)
+    join_tab_scan->free();
+}
+
+
 static bool add_mrr_explain_info(String *str, uint mrr_mode, handler *file)
 {
   char mrr_str_buf[128]={0};
@@ -3133,7 +3151,7 @@ bool JOIN_CACHE_HASHED::key_search(uchar *key, uint key_len,
 */
 
 inline
-uint JOIN_CACHE_HASHED::get_hash_idx_simple(uchar* key, uint key_len)
+ulong JOIN_CACHE_HASHED::get_hash_value_simple(uchar* key, uint key_len)
 {
   ulong nr= 1;
   ulong nr2= 4;
@@ -3144,7 +3162,13 @@ uint JOIN_CACHE_HASHED::get_hash_idx_simple(uchar* key, uint key_len)
     nr^= (ulong) ((((uint) nr & 63)+nr2)*((uint) *pos))+ (nr << 8);
     nr2+= 3;
   }
-  return nr % hash_entries;
+  return nr;
+}
+
+inline
+uint JOIN_CACHE_HASHED::get_hash_idx_simple(uchar* key, uint key_len)
+{
+  return get_hash_value_simple(key, key_len) % hash_entries;
 }
 
 
@@ -3179,6 +3203,31 @@ uint JOIN_CACHE_HASHED::get_hash_idx_complex(uchar *key, uint key_len)
 }
 
 
+/*
+  Get the hash value of a key used by the hash function of the cache
+
+  SYNOPSIS
+    get_hash_value()
+      key             pointer to the key value
+      key_len         key value length
+
+  DESCRIPTION
+    The function returns the value that the hash function hash_func reduces
+    to the index of the hash entry for the key. Any two keys that are equal
+    for the function hash_cmp_func get the same value.
+
+  RETURN VALUE
+    the hash value of the key
+*/
+
+ulong JOIN_CACHE_HASHED::get_hash_value(uchar *key, uint key_len)
+{
+  if (hash_func == &JOIN_CACHE_HASHED::get_hash_idx_complex)
+    return key_hashnr(ref_key_info, ref_used_key_parts, key);
+  return get_hash_value_simple(key, key_len);
+}
+
+
 /* 
   Compare two key entries in the hash table as sequence of bytes
 
@@ -3344,10 +3393,139 @@ uint JOIN_CACHE_HASHED::get_next_key(uchar ** key)
 
 int JOIN_TAB_SCAN::open()
 {
+  int err;
   save_or_restore_used_tabs(join_tab, FALSE);
   is_first_record= TRUE;
   join_tab->tracker->r_scans++;
-  return join_init_read_record(join_tab);
+  if (rescan_state == RESCAN_READING)
+    return reinit_io_cache(&rescan_file, READ_CACHE, 0L, 0, 0) ? 1 : 0;
+  if (rescan_state == PARTITION_READING)
+    return reinit_io_cache(partition_files + curr_partition, READ_CACHE,
+                           0L, 0, 0) ? 1 : 0;
+  if (scans++ == 1 && rescan_state == RESCAN_NONE && can_use_rescan_file_now())
+  {
+    if (open_cached_file(&rescan_file, mysql_tmpdir, TEMP_PREFIX,
+                         DISK_BUFFER_SIZE, MYF(MY_WME)))
+      rescan_state= RESCAN_FAILED;
+    else
+      rescan_state= RESCAN_WRITING;
+  }
+  err= join_init_read_record(join_tab);
+  if (err < 0)
+  {
+    /* The table is empty */
+    if (rescan_state == RESCAN_WRITING)
+      rescan_state= RESCAN_WRITTEN;
+    else if (rescan_state == PARTITION_WRITING)
+      rescan_state= PARTITION_WRITTEN;
+  }
+  return err;
+}
+
+
+/*
+  Check whether the rescans of a table joined through a join buffer can
+  read the rows of the table from a temporary file instead of the engine
+
+  SYNOPSIS
+    can_use_rescan_file()
+      join     the join the table belongs to
+      tab      the table
+
+  DESCRIPTION
+    The function checks the conditions that do not depend on the chosen
+    execution plan, so that it can be used by the optimizer as well:
+    - the optimizer switch join_cache_rescan_file is on
+    - the join is executed with the same outer references every time
+    - the table has no blobs whose data would not be in record[0]
+    - the table is not an internal temporary table, which is usually
+      cheaper to read than the temporary file
+
+  RETURN VALUE
+    TRUE   the rescans can read the temporary file
+    FALSE  otherwise
+*/
+
+bool JOIN_TAB_SCAN::can_use_rescan_file(JOIN *join, JOIN_TAB *tab)
+{
+  TABLE *table= tab->table;
+  return optimizer_flag(join->thd, OPTIMIZER_SWITCH_JOIN_CACHE_RESCAN_FILE) &&
+         !join->select_lex->uncacheable &&
+         table && !table->s->blob_fields &&
+         table->s->tmp_table == NO_TMP_TABLE;
+}
+
+
+/*
+  Check whether this scan can write the rows to the temporary file:
+  can_use_rescan_file() and the conditions that depend on the execution plan
+*/
+
+bool JOIN_TAB_SCAN::can_use_rescan_file_now()
+{
+  return can_use_rescan_file(join, join_tab) &&
+         !join_tab->keep_current_rowid &&
+         join_tab->use_quick != 2;
+}
+
+
+void JOIN_TAB_SCAN::free_rescan_file()
+{
+  if (rescan_state == RESCAN_WRITING || rescan_state == RESCAN_WRITTEN ||
+      rescan_state == RESCAN_READING)
+    close_cached_file(&rescan_file);
+  for (uint n= 0; n < partitions; n++)
+    close_cached_file(partition_files + n);
+  partitions= 0;
+  rescan_state= RESCAN_NONE;
+  scans= 0;
+}
+
+
+/*
+  Make the next scan of the table write the rows into partition files
+
+  SYNOPSIS
+    start_partitions()
+      part_cache   the cache that assigns the rows to the partitions
+      n            the number of the partitions
+
+  DESCRIPTION
+    The function prepares the first scan of join_tab to write every row
+    that meets the condition pushed to the table into one of 'n' partition
+    files. The number of the file is returned by the function
+    part_cache->get_inner_partition(). The further scans read only the rows of
+    the partition set by the function set_partition().
+    The function is called by a JOIN_CACHE_BNLH cache when it decides to
+    partition the join (see JOIN_CACHE_BNLH::join_records).
+
+  RETURN VALUE
+    TRUE   the next scan writes the partition files
+    FALSE  the table cannot be partitioned
+*/
+
+bool JOIN_TAB_SCAN::start_partitions(JOIN_CACHE_BNLH *part_cache, uint n)
+{
+  THD *thd= join->thd;
+  if (scans || rescan_state != RESCAN_NONE || !can_use_rescan_file_now())
+    return FALSE;
+  if (!(partition_files= (IO_CACHE *) thd->calloc(n * sizeof(IO_CACHE))) ||
+      !(partition_rows= (ha_rows *) thd->calloc(n * sizeof(ha_rows))))
+    return FALSE;
+  for (partitions= 0; partitions < n; partitions++)
+  {
+    if (open_cached_file(partition_files + partitions, mysql_tmpdir,
+                         TEMP_PREFIX, JOIN_CACHE_PARTITION_BUFFER_SIZE,
+                         MYF(MY_WME)))
+    {
+      free_rescan_file();
+      return FALSE;
+    }
+  }
+  partition_cache= part_cache;
+  curr_partition= 0;
+  rescan_state= PARTITION_WRITING;
+  return TRUE;
 }
 
 
@@ -3379,6 +3557,20 @@ int JOIN_TAB_SCAN::next()
   READ_RECORD *info= &join_tab->read_record;
   SQL_SELECT *select= join_tab->cache_select;
   THD *thd= join->thd;
+  TABLE *table= join_tab->table;
+
+  if (rescan_state == RESCAN_READING || rescan_state == PARTITION_READING)
+  {
+    IO_CACHE *file= rescan_state == RESCAN_READING ?
+                      &rescan_file : partition_files + curr_partition;
+    is_first_record= FALSE;
+    if (my_b_read(file, table->record[0], table->s->reclength))
+      return file->error ? 1 : -1;
+    table->status= 0;
+    join_tab->tracker->r_rows++;
+    join_tab->tracker->r_rows_after_where++;
+    return 0;
+  }
 
   if (is_first_record)
     is_first_record= FALSE;
@@ -3406,7 +3598,27 @@ int JOIN_TAB_SCAN::next()
   }
 
   if (!err)
+  {
     join_tab->tracker->r_rows_after_where++;
+    if (rescan_state == RESCAN_WRITING &&
+        my_b_write(&rescan_file, table->record[0], table->s->reclength))
+      return 1;
+    if (rescan_state == PARTITION_WRITING)
+    {
+      uint n= partition_cache->get_inner_partition();
+      if (my_b_write(partition_files + n, table->record[0],
+                     table->s->reclength))
+        return 1;
+      partition_rows[n]++;
+    }
+  }
+  else if (err < 0)
+  {
+    if (rescan_state == RESCAN_WRITING)
+      rescan_state= RESCAN_WRITTEN;
+    else if (rescan_state == PARTITION_WRITING)
+      rescan_state= PARTITION_WRITTEN;
+  }
   return err; 
 }
 
@@ -3471,6 +3683,17 @@ static void save_or_restore_used_tabs(JOIN_TAB *join_tab, bool save)
 void JOIN_TAB_SCAN::close()
 {
   save_or_restore_used_tabs(join_tab, TRUE);
+  if (rescan_state == RESCAN_WRITTEN)
+    rescan_state= RESCAN_READING;
+  else if (rescan_state == PARTITION_WRITTEN)
+    rescan_state= PARTITION_READING;
+  else if (rescan_state == RESCAN_WRITING ||
+           rescan_state == PARTITION_WRITING)
+  {
+    /* The scan was not finished: the files miss rows */
+    free_rescan_file();
+    rescan_state= RESCAN_FAILED;
+  }
 }
 
 
@@ -3807,6 +4030,9 @@ int JOIN_CACHE_BNLH::init(bool for_explain)
 {
   DBUG_ENTER("JOIN_CACHE_BNLH::init");
 
+  partition_state= PARTITION_NONE;
+  partitions= 0;
+
   if (!(join_tab_scan= new JOIN_TAB_SCAN(join, join_tab)))
     DBUG_RETURN(1);
 
@@ -3814,6 +4040,370 @@ int JOIN_CACHE_BNLH::init(bool for_explain)
 }
 
 
+/*
+  Add a record into the buffer of a BNLH join cache
+
+  SYNOPSIS
+    put_record()
+
+  DESCRIPTION
+    This implementation of the virtual function put_record writes the record
+    into its partition file when the join is partitioned. Otherwise it adds
+    the record into the join buffer. When the buffer gets full for the first
+    time the function tries to start the partitioning of the join, which is
+    done by the call of join_records that follows.
+
+  RETURN VALUE
+    TRUE    if it has been decided that it should be the last record
+            in the join buffer, or the record could not be written into
+            its partition file
+    FALSE   otherwise
+*/
+
+bool JOIN_CACHE_BNLH::put_record()
+{
+  if (partition_state == PARTITION_SPILLING)
+    return spill_record();
+  if (!JOIN_CACHE_HASHED::put_record())
+    return FALSE;
+  if (partition_state == PARTITION_NONE)
+    partition_state= start_partitions() ? PARTITION_STARTING : PARTITION_OFF;
+  return TRUE;
+}
+
+
+/*
+  Join records from the join buffer of a BNLH cache with records of join_tab
+
+  SYNOPSIS
+    join_records()
+      skip_last    do not look for matches for the last partial join record
+
+  DESCRIPTION
+    Without partitioning every refill of the join buffer is joined with all
+    rows of join_tab. With the optimizer switch join_cache_rescan_file the
+    refills read the rows from a temporary file (see JOIN_TAB_SCAN::open),
+    yet the number of the read rows still grows with the number of refills.
+    Therefore when the buffer gets full for the first time the cache tries
+    to partition the join, like a grace hash join does:
+    - the scan that joins the first refill writes the rows of join_tab
+      into partition files by the hash value of their join keys
+    - the records that follow are written into partition files of the
+      cache by the hash value of their join keys instead of the buffer
+    - after the last record has been received every partition of records
+      is loaded into the buffer and joined with the rows of the same
+      partition only.
+    As equal keys have equal hash values a record can only match the rows
+    of its own partition, so every row of join_tab is read about once,
+    however many refills the partitions need.
+    The partitioning is only used for inner joins without semi-join
+    strategies, when this cache is not linked to a previous one and its
+    records contain no blobs and no rowids.
+
+  RETURN VALUE
+    return one of enum_nested_loop_state, except NESTED_LOOP_NO_MORE_ROWS.
+*/
+
+enum_nested_loop_state JOIN_CACHE_BNLH::join_records(bool skip_last)
+{
+  enum_nested_loop_state rc;
+
+  if (partition_state == PARTITION_SPILLING)
+    return join_partitions();
+
+  rc= JOIN_CACHE_HASHED::join_records(skip_last);
+
+  if (partition_state == PARTITION_STARTING)
+  {
+    if ((rc == NESTED_LOOP_OK || rc == NESTED_LOOP_NO_MORE_ROWS) &&
+        join_tab_scan->is_partitioned())
+      partition_state= PARTITION_SPILLING;
+    else
+    {
+      free_partitions();
+      partition_state= PARTITION_OFF;
+    }
+  }
+  return rc;
+}
+
+
+/*
+  Start the partitioning of the join by a BNLH cache
+
+  SYNOPSIS
+    start_partitions()
+
+  DESCRIPTION
+    The function checks whether the join can be partitioned (see
+    join_records), and if so it opens the partition files for the records
+    of the cache and makes the next scan of join_tab write the partition
+    files for the rows of the table. The number of partitions is chosen
+    so that every partition of records is expected to fit into the join
+    buffer.
+
+  RETURN VALUE
+    TRUE   the partitioning has been started
+    FALSE  otherwise
+*/
+
+bool JOIN_CACHE_BNLH::start_partitions()
+{
+  THD *thd= join->thd;
+  CACHE_FIELD *copy= field_descr;
+  CACHE_FIELD *copy_end= field_descr+fields;
+  double n;
+
+  if (prev_cache || blobs || with_match_flag || join_tab->bush_root_tab)
+    return FALSE;
+  for (JOIN_TAB *tab= join->join_tab+join->const_tables; tab <= join_tab;
+       tab++)
+  {
+    if (tab->first_inner || tab->emb_sj_nest || tab->bush_children)
+      return FALSE;
+  }
+  for ( ; copy < copy_end; copy++)
+  {
+    if (copy->type == CACHE_ROWID)
+      return FALSE;
+  }
+
+  n= (join_tab-1)->get_partial_join_cardinality() / records + 1;
+  set_if_smaller(n, JOIN_CACHE_MAX_PARTITIONS);
+  set_if_bigger(n, 2);
+
+  if (!join_tab_scan->start_partitions(this, (uint) n))
+    return FALSE;
+  if (!(partition_files= (IO_CACHE *) thd->calloc((uint) n *
+                                                  sizeof(IO_CACHE))) ||
+      !(partition_records= (ha_rows *) thd->calloc((uint) n *
+                                                   sizeof(ha_rows))))
+  {
+    join_tab_scan->free();
+    return FALSE;
+  }
+  for (partitions= 0; partitions < (uint) n; partitions++)
+  {
+    if (open_cached_file(partition_files + partitions, mysql_tmpdir,
+                         TEMP_PREFIX, JOIN_CACHE_PARTITION_BUFFER_SIZE,
+                         MYF(MY_WME)))
+    {
+      free_partitions();
+      join_tab_scan->free();
+      return FALSE;
+    }
+  }
+  partition_error= FALSE;
+  return TRUE;
+}
+
+
+/*
+  Get the partition of a join key
+
+  SYNOPSIS
+    get_partition()
+      key    the key value
+
+  DESCRIPTION
+    The function mixes the bits of the hash value of the key before it
+    reduces the value to the number of a partition, so that the records
+    of one partition are not crowded into a few entries of the hash table
+    that reduces the same value.
+
+  RETURN VALUE
+    the number of the partition for the key
+*/
+
+uint JOIN_CACHE_BNLH::get_partition(uchar *key)
+{
+  ulonglong nr= get_hash_value(key, key_length);
+  return (uint) (((nr * 0x9E3779B97F4A7C15ULL) >> 32) % partitions);
+}
+
+
+/*
+  Get the partition of the record of join_tab in its record buffer
+
+  SYNOPSIS
+    get_inner_partition()
+
+  DESCRIPTION
+    The function is called by the scan of join_tab that writes the rows of
+    the table into the partition files (see JOIN_TAB_SCAN::start_partitions).
+    It builds the join key out of the record like the function
+    get_matching_chain_by_join_key does.
+
+  RETURN VALUE
+    the number of the partition for the record
+*/
+
+uint JOIN_CACHE_BNLH::get_inner_partition()
+{
+  TABLE_REF *ref= &join_tab->ref;
+  KEY *keyinfo= join_tab->get_keyinfo_by_key_no(ref->key);
+  key_copy(key_buff, join_tab->table->record[0], keyinfo, key_length, TRUE);
+  return get_partition(key_buff);
+}
+
+
+/*
+  Write the fields of the current partial join record into its partition file
+
+  SYNOPSIS
+    spill_record()
+
+  DESCRIPTION
+    The function builds the join key over the fields read into the record
+    buffers and writes the images of all fields stored by the cache into the
+    partition file for the key. The images are written in full, so the
+    function read_spilled_record can restore them in the record buffers.
+
+  RETURN VALUE
+    TRUE    the record could not be written
+    FALSE   otherwise
+*/
+
+bool JOIN_CACHE_BNLH::spill_record()
+{
+  TABLE_REF *ref= &join_tab->ref;
+  CACHE_FIELD *copy= field_descr;
+  CACHE_FIELD *copy_end= field_descr+fields;
+  uint n;
+
+  cp_buffer_from_ref(join->thd, join_tab->table, ref);
+  n= get_partition(ref->key_buff);
+  for ( ; copy < copy_end; copy++)
+  {
+    if (my_b_write(partition_files + n, copy->str, copy->length))
+    {
+      partition_error= TRUE;
+      return TRUE;
+    }
+  }
+  partition_records[n]++;
+  return FALSE;
+}
+
+
+/*
+  Read the fields of the next partial join record from a partition file
+
+  SYNOPSIS
+    read_spilled_record()
+      file    the partition file
+
+  DESCRIPTION
+    The function restores the fields written by spill_record in the record
+    buffers.
+
+  RETURN VALUE
+    TRUE    the record could not be read
+    FALSE   otherwise
+*/
+
+bool JOIN_CACHE_BNLH::read_spilled_record(IO_CACHE *file)
+{
+  CACHE_FIELD *copy= field_descr;
+  CACHE_FIELD *copy_end= field_descr+fields;
+  for ( ; copy < copy_end; copy++)
+  {
+    if (my_b_read(file, copy->str, copy->length))
+      return TRUE;
+  }
+  return FALSE;
+}
+
+
+/*
+  Join the partitions of records with the partitions of join_tab
+
+  SYNOPSIS
+    join_partitions()
+
+  DESCRIPTION
+    The function is called after the last partial join record has been
+    written into a partition file. For every partition it loads the records
+    into the join buffer and joins them with the rows of join_tab from the
+    same partition, refilling the buffer as many times as needed. The
+    partitions without records or without rows are skipped, as their records
+    cannot have any matches.
+    At the end the function releases the partition files of both sides.
+
+  RETURN VALUE
+    return one of enum_nested_loop_state, except NESTED_LOOP_NO_MORE_ROWS.
+*/
+
+enum_nested_loop_state JOIN_CACHE_BNLH::join_partitions()
+{
+  enum_nested_loop_state rc= NESTED_LOOP_OK;
+  DBUG_ENTER("JOIN_CACHE_BNLH::join_partitions");
+
+  if (partition_error)
+  {
+    rc= NESTED_LOOP_ERROR;
+    goto finish;
+  }
+  for (uint n= 0; n < partitions; n++)
+  {
+    IO_CACHE *file= partition_files + n;
+    ha_rows rows= partition_records[n];
+    if (!rows || !join_tab_scan->get_partition_rows(n))
+      continue;
+    if (reinit_io_cache(file, READ_CACHE, 0L, 0, 0))
+    {
+      rc= NESTED_LOOP_ERROR;
+      goto finish;
+    }
+    join_tab_scan->set_partition(n);
+    for ( ; rows; rows--)
+    {
+      if (read_spilled_record(file))
+      {
+        rc= NESTED_LOOP_ERROR;
+        goto finish;
+      }
+      if (JOIN_CACHE_HASHED::put_record() || rows == 1)
+      {
+        rc= JOIN_CACHE_HASHED::join_records(FALSE);
+        if (rc != NESTED_LOOP_OK && rc != NESTED_LOOP_NO_MORE_ROWS)
+          goto finish;
+      }
+    }
+  }
+
+finish:
+  free_partitions();
+  join_tab_scan->free();
+  partition_state= PARTITION_NONE;
+  DBUG_RETURN(rc);
+}
+
+
+/*
+  Close the partition files of the records of a BNLH cache
+*/
+
+void JOIN_CACHE_BNLH::free_partitions()
+{
+  for (uint n= 0; n < partitions; n++)
+    close_cached_file(partition_files + n);
+  partitions= 0;
+}
+
+
+/*
+  Free the join buffer and the partition files of a BNLH cache
+*/
+
+void JOIN_CACHE_BNLH::free()
+{
+  free_partitions();
+  partition_state= PARTITION_NONE;
+  JOIN_CACHE_HASHED::free();
+}
+
+
 /* 
   Calculate the increment of the MRR buffer for a record write       
 
@@ -62,6 +62,7 @@ typedef struct st_cache_field {
 
 
 class JOIN_TAB_SCAN;
+class JOIN_CACHE_BNLH;
 
 class EXPLAIN_BKA_TYPE;
 
@@ -540,6 +541,7 @@ class JOIN_CACHE :public Sql_alloc
     join_tab= tab;
     prev_cache= next_cache= 0;
     buff= 0;
+    join_tab_scan= 0;
   }
 
   /* 
@@ -555,6 +557,7 @@ class JOIN_CACHE :public Sql_alloc
     next_cache= 0;
     prev_cache= prev;
     buff= 0;
+    join_tab_scan= 0;
     if (prev)
       prev->next_cache= this;
   }
@@ -659,7 +662,7 @@ class JOIN_CACHE :public Sql_alloc
   }
      
   /* Join records from the join buffer with records from the next join table */ 
-  enum_nested_loop_state join_records(bool skip_last);
+  virtual enum_nested_loop_state join_records(bool skip_last);
 
   /* Add a comment on the join algorithm employed by the join cache */
   virtual bool save_explain_data(EXPLAIN_BKA_TYPE *explain);
@@ -668,11 +671,7 @@ class JOIN_CACHE :public Sql_alloc
 
   virtual ~JOIN_CACHE() {}
   void reset_join(JOIN *j) { join= j; }
-  void free()
-  { 
-    my_free(buff);
-    buff= 0;
-  }   
+  virtual void free();
   
   friend class JOIN_CACHE_HASHED;
   friend class JOIN_CACHE_BNL;
@@ -791,6 +790,7 @@ class JOIN_CACHE_HASHED: public JOIN_CACHE
   /* The offset of the data fields from the beginning of the record fields */
   uint data_fields_offset;
 
+  inline ulong get_hash_value_simple(uchar *key, uint key_len);
   inline uint get_hash_idx_simple(uchar *key, uint key_len);
   inline uint get_hash_idx_complex(uchar *key, uint key_len);
 
@@ -849,6 +849,9 @@ class JOIN_CACHE_HASHED: public JOIN_CACHE
 
   uint get_size_of_key_offset() { return size_of_key_ofs; }
 
+  /* Get the hash value of a key before it is reduced to a hash entry index */
+  ulong get_hash_value(uchar *key, uint key_len);
+
   /* 
     Get the position of the next_key_ptr field pointed to by 
     a linking reference stored at the position key_ref_ptr. 
@@ -1042,6 +1045,37 @@ class JOIN_TAB_SCAN: public Sql_alloc
   /* TRUE if this is the first record from the joined table to iterate over */
   bool is_first_record;
 
+  /*
+    With the optimizer switch join_cache_rescan_file the rows of join_tab
+    that meet the condition pushed to it are written to rescan_file by the
+    second scan of the table, i.e. by the first one caused by a refill of
+    the join buffer. All further scans read them back from the file instead
+    of the table.
+    When the table is joined by a JOIN_CACHE_BNLH cache that partitions the
+    join (see JOIN_CACHE_BNLH::join_records) the first scan writes the rows
+    to partition_files by the hash of their join key instead, and every
+    further scan reads only the file of the partition curr_partition.
+  */
+  enum { RESCAN_NONE, RESCAN_WRITING, RESCAN_WRITTEN, RESCAN_READING,
+         RESCAN_FAILED, PARTITION_WRITING, PARTITION_WRITTEN,
+         PARTITION_READING } rescan_state;
+  /* The number of scans of join_tab started so far */
+  uint scans;
+  IO_CACHE rescan_file;
+
+  /* The cache that assigns the rows to the partitions */
+  JOIN_CACHE_BNLH *partition_cache;
+  /* The number of the partition files */
+  uint partitions;
+  IO_CACHE *partition_files;
+  /* The number of the rows written into each of the partition files */
+  ha_rows *partition_rows;
+  /* The partition read by the scans */
+  uint curr_partition;
+
+  bool can_use_rescan_file_now();
+  void free_rescan_file();
+
 protected:
 
   /* The joined table to be iterated over */
@@ -1061,9 +1095,19 @@ class JOIN_TAB_SCAN: public Sql_alloc
     join= j;
     join_tab= tab;
     cache= join_tab->cache;
+    rescan_state= RESCAN_NONE;
+    scans= 0;
+    partitions= 0;
   }
 
   virtual ~JOIN_TAB_SCAN() {}
+
+  /*
+    Check whether the rows of the table read by 'tab' could be written to
+    a temporary file instead of being read again for every refill of the
+    join buffer
+  */
+  static bool can_use_rescan_file(JOIN *join, JOIN_TAB *tab);
  
   /* 
     Shall calculate the increment of the auxiliary buffer for a record
@@ -1084,6 +1128,21 @@ class JOIN_TAB_SCAN: public Sql_alloc
   */ 
   virtual void close();
 
+  /* Release the resources that are kept between the scans */
+  virtual void free() { free_rescan_file(); }
+
+  /* Make the next scan write the rows into 'n' partition files */
+  bool start_partitions(JOIN_CACHE_BNLH *part_cache, uint n);
+
+  /* Check whether the rows have been written into the partition files */
+  bool is_partitioned() { return rescan_state == PARTITION_READING; }
+
+  /* Get the number of the rows in the partition 'n' */
+  ha_rows get_partition_rows(uint n) { return partition_rows[n]; }
+
+  /* Make the further scans read the rows of the partition 'n' */
+  void set_partition(uint n) { curr_partition= n; }
+
 };
 
 /*
@@ -1164,6 +1223,32 @@ class JOIN_CACHE_BNLH :public JOIN_CACHE_HASHED
   */
   uchar *next_matching_rec_ref_ptr;
 
+  /*
+    The state of the partitioning of the join. When the join buffer gets
+    full for the first time the cache may decide to partition the join
+    (see join_records): the rows of join_tab are written into partition
+    files of join_tab_scan and the records that follow are written into
+    partition_files instead of the join buffer. The partitions are joined
+    one by one after the last record has been received.
+  */
+  enum { PARTITION_NONE, PARTITION_STARTING, PARTITION_SPILLING,
+         PARTITION_OFF } partition_state;
+  /* The number of the partitions */
+  uint partitions;
+  /* The files with the records of the partitions */
+  IO_CACHE *partition_files;
+  /* The number of the records written into each of partition_files */
+  ha_rows *partition_records;
+  /* Set when a record could not be written into its partition file */
+  bool partition_error;
+
+  bool start_partitions();
+  uint get_partition(uchar *key);
+  bool spill_record();
+  bool read_spilled_record(IO_CACHE *file);
+  enum_nested_loop_state join_partitions();
+  void free_partitions();
+
   /*
     Get the chain of records from buffer matching the current candidate
     record for join
@@ -1203,6 +1288,15 @@ class JOIN_CACHE_BNLH :public JOIN_CACHE_HASHED
 
   bool is_key_access() { return TRUE; }
 
+  bool put_record();
+
+  enum_nested_loop_state join_records(bool skip_last);
+
+  void free();
+
+  /* Get the partition of the record of join_tab in its record buffer */
+  uint get_inner_partition();
+
 };
 
 
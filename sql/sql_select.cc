@@ -6573,6 +6573,50 @@ double matching_candidates_in_table(JOIN_TAB *s, bool with_found_constraint,
 }
 
 
+/**
+  Estimate the cost of all scans of a table joined through a join buffer
+
+  @param join          the join
+  @param s             the joined table
+  @param idx           the position of the table in the partial plan
+  @param scan_time     the cost of one scan of the table
+  @param record_count  the number of records in the partial plan
+  @param rnd_records   the number of records of the table that meet the
+                       condition pushed to it
+  @param hash_join     TRUE <=> the table is joined by a hash join
+
+  @details
+    The table is read once for every refill of the join buffer. With the
+    optimizer switch join_cache_rescan_file only the first two scans read the
+    table: the second one writes the records to a temporary file that is
+    read by all further scans (see JOIN_TAB_SCAN::open). An inner hash join
+    is partitioned instead: the first scan writes the records of the table
+    into partition files and the records of the partial plan are written
+    into partition files as well, after which both are read once (see
+    JOIN_CACHE_BNLH::join_records).
+
+  @return
+    The cost of the scans
+*/
+
+static double join_buffer_scan_time(JOIN *join, JOIN_TAB *s, uint idx,
+                                    double scan_time, double record_count,
+                                    double rnd_records, bool hash_join)
+{
+  double buff_bytes= (double) cache_record_length(join, idx) * record_count;
+  double refills= floor(buff_bytes /
+                        (double) join->thd->variables.join_buff_size);
+  if (refills >= 1.0 && JOIN_TAB_SCAN::can_use_rescan_file(join, s))
+  {
+    double file_time= rnd_records * s->table->s->reclength / (double) IO_SIZE;
+    if (hash_join && !s->emb_sj_nest && !(s->table->map & join->outer_join))
+      return scan_time + 2.0 * (file_time + buff_bytes / (double) IO_SIZE);
+    return 2.0 * scan_time + refills * file_time;
+  }
+  return scan_time * (1.0 + refills);
+}
+
+
 /**
   Find the best access path for an extension of a partial execution
   plan and add this path to the plan.
@@ -7056,9 +7100,8 @@ best_access_path(JOIN      *join,
     tmp+= (s->records - rnd_records)/(double) TIME_FOR_COMPARE;
 
     /* We read the table as many times as join buffer becomes full. */
-    tmp*= (1.0 + floor((double) cache_record_length(join,idx) *
-                          record_count /
-                          (double) thd->variables.join_buff_size));
+    tmp= join_buffer_scan_time(join, s, idx, tmp, record_count, rnd_records,
+                               TRUE);
     best_time= tmp + 
                (record_count*join_sel) / TIME_FOR_COMPARE * rnd_records;
     best= tmp;
@@ -7157,9 +7200,8 @@ best_access_path(JOIN      *join,
       else
       {
         /* We read the table as many times as join buffer becomes full. */
-        tmp*= (1.0 + floor((double) cache_record_length(join,idx) *
-                           record_count /
-                           (double) thd->variables.join_buff_size));
+        tmp= join_buffer_scan_time(join, s, idx, tmp, record_count,
+                                   rnd_records, FALSE);
         /* 
             We don't make full cartesian product between rows in the scanned
            table and existing records because we skip all rows from the
@@ -21470,7 +21512,7 @@ uint find_shortest_key(TABLE *table, const key_map *usable_keys)
     {
       if (usable_keys->is_set(nr))
       {
-        double cost= table->file->keyread_time(nr, 1, table->file->records());
+        double cost= table->file->keyread_time(nr, 1, table->file->stats.records);
         if (cost < min_cost)
         {
           min_cost= cost;
@@ -200,12 +200,12 @@ TABLE_FIELD_TYPE column_stat_fields[COLUMN_STAT_N_FIELDS] =
   },
   {
     { STRING_WITH_LEN("hist_type") },
-    { STRING_WITH_LEN("enum('SINGLE_PREC_HB','DOUBLE_PREC_HB')") },
+    { STRING_WITH_LEN("enum('SINGLE_PREC_HB','DOUBLE_PREC_HB','MCV_HB')") },
     { STRING_WITH_LEN("utf8") }
   },
   {
     { STRING_WITH_LEN("histogram") },
-    { STRING_WITH_LEN("varbinary(255)") },
+    { STRING_WITH_LEN("blob") },
     { NULL, 0 }
   }
 };
@@ -1089,7 +1089,8 @@ class Column_stat: public Stat_table
           const char * col_histogram=
           (const char *) (table_field->collected_stats->histogram.get_values());
 	  stat_field->store(col_histogram,
-                            table_field->collected_stats->histogram.get_size(),
+                            table_field->collected_stats->histogram.get_size() +
+                            table_field->collected_stats->histogram.get_text_size(),
                             &my_charset_bin);
           break;           
         }
@@ -1175,6 +1176,17 @@ class Column_stat: public Stat_table
           }
         }
       }
+
+      /* The texts of the most common values follow the histogram */
+      Histogram *hist= &table_field->read_stats->histogram;
+      Field *stat_field= stat_table->field[COLUMN_STAT_HISTOGRAM];
+      hist->set_text_size(0);
+      if (hist->get_type() == MCV_HB && !stat_field->is_null())
+      {
+        stat_field->val_str(&val);
+        if (val.length() > hist->get_size())
+          hist->set_text_size(val.length() - hist->get_size());
+      }
     }
   }
 
@@ -1189,9 +1201,10 @@ class Column_stat: public Stat_table
     Column_stat::set_key_fields. Then, if the row is found, the function reads
     the value of the column 'histogram' of the  table column_stat and sets
     accordingly the corresponding bit in the bitmap read_stat.column_stat_nulls.
-    The method assumes that the value of histogram size and the pointer to
-    the histogram location has been already set in the fields size and values
-    of read_stats->histogram.
+    The method assumes that the value of histogram size, the size of the
+    texts following the histogram and the pointer to the histogram location
+    has been already set in the fields size, text_size and values of
+    read_stats->histogram.
   */    
 
   void get_histogram_value()
@@ -1202,10 +1215,11 @@ class Column_stat: public Stat_table
       String val(buff, sizeof(buff), &my_charset_bin);
       uint fldno= COLUMN_STAT_HISTOGRAM;
       Field *stat_field= stat_table->field[fldno];
+      Histogram *hist= &table_field->read_stats->histogram;
       table_field->read_stats->set_not_null(fldno);
       stat_field->val_str(&val);
-      memcpy(table_field->read_stats->histogram.get_values(),
-             val.ptr(), table_field->read_stats->histogram.get_size());
+      memcpy(hist->get_values(), val.ptr(),
+             MY_MIN(val.length(), hist->get_size() + hist->get_text_size()));
     }
   }
 
@@ -1592,6 +1606,292 @@ int histogram_build_walk(void *elem, element_count elem_cnt, void *arg)
 C_MODE_END
 
 
+/*
+  Mcv_histogram_builder is a helper class that is used to build histograms
+  of the type MCV_HB (see class Histogram).
+
+  The distinct values of the column are walked once in ascending order.
+  They are put into fine-grained buckets of equal heights, and the values
+  with the largest numbers of occurrences are remembered. When the walk is
+  over, the most common of these values are taken out of their fine
+  buckets, and the fine buckets are merged into the buckets of the
+  histogram so that these have equal heights again. The texts of the ends
+  of the fine buckets are kept for the ends of the merged buckets.
+*/
+
+class Mcv_histogram_builder
+{
+  /* The number of the fine-grained buckets */
+  static const uint FINE_BUCKETS= 256;
+  /* The maximal number of the most common values */
+  static const uint MAX_VALUES= 255 / (4 * Histogram::MCV_VALUE_SIZE);
+
+  struct Fine_bucket
+  {
+    double end;            /* position of the largest value in the bucket  */
+    ulonglong rows;        /* number of values in the bucket               */
+    ulonglong distinct;    /* number of distinct values in the bucket      */
+    uint text_length;      /* length of the text of the largest value      */
+    uchar *text;           /* the text, cut to MCV_MAX_TEXT_LENGTH bytes   */
+  };
+
+  struct Candidate
+  {
+    ulonglong number;      /* number of the value in the walk              */
+    double pos;            /* position of the value                        */
+    ulonglong rows;        /* number of occurrences of the value           */
+    uint fine_bucket;      /* the fine bucket the value was put into       */
+    uint text_length;      /* length of the text of the value              */
+    uchar text[Histogram::MCV_MAX_TEXT_LENGTH];
+  };
+
+  Field *column;           /* table field for which the histogram is built */
+  uint col_length;         /* size of this field                           */
+  ha_rows records;         /* number of records the histogram is built for */
+  Field *min_value;        /* pointer to the minimal value for the field   */
+  Field *max_value;        /* pointer to the maximal value for the field   */
+  Histogram *histogram;    /* the histogram location                       */
+  Fine_bucket fine[FINE_BUCKETS];
+  uint curr_fine;          /* number of the current fine bucket            */
+  uchar *fine_texts;       /* room for the texts of the fine bucket ends   */
+  double fine_capacity;    /* number of rows in a fine bucket              */
+  Candidate candidates[MAX_VALUES];
+  uint n_candidates;
+  uint max_candidates;     /* room for the most common values              */
+  ulonglong count;         /* number of values retrieved                   */
+  ulonglong count_distinct;    /* number of distinct values retrieved      */
+
+  static uint16 to_share(double val)
+  {
+    return (uint16) MY_MIN(val * 65535 + 0.5, 65535);
+  }
+
+  /* Take the value in the record of the column for the end of a bucket */
+  void set_end_text(Fine_bucket *bucket)
+  {
+    char buff[MAX_FIELD_WIDTH];
+    String val(buff, sizeof(buff), column->charset());
+    String *res= column->val_str(&val);
+    bucket->text_length= (uint) MY_MIN(res->length(),
+                                       Histogram::MCV_MAX_TEXT_LENGTH);
+    memcpy(bucket->text, res->ptr(), bucket->text_length);
+  }
+
+public:
+  Mcv_histogram_builder(Field *col, uint col_len, ha_rows rows)
+    : column(col), col_length(col_len), records(rows)
+  {
+    Column_statistics *col_stats= col->collected_stats;
+    min_value= col_stats->min_value;
+    max_value= col_stats->max_value;
+    histogram= &col_stats->histogram;
+    memset(histogram->get_values(), 0, histogram->get_size());
+    memset(fine, 0, sizeof(fine));
+    curr_fine= 0;
+    fine_texts= (uchar *) alloc_root(col->table->in_use->mem_root,
+                                     FINE_BUCKETS *
+                                     Histogram::MCV_MAX_TEXT_LENGTH);
+    for (uint i= 0; fine_texts && i < FINE_BUCKETS; i++)
+      fine[i].text= fine_texts + i * Histogram::MCV_MAX_TEXT_LENGTH;
+    fine_capacity= (double) records / FINE_BUCKETS;
+    n_candidates= 0;
+    max_candidates= 0;
+    if (histogram->get_size() >= Histogram::MCV_HEADER_SIZE)
+      max_candidates= MY_MIN(MAX_VALUES,
+                             (histogram->get_size() -
+                              Histogram::MCV_HEADER_SIZE) /
+                             (4 * Histogram::MCV_VALUE_SIZE));
+    count= 0;
+    count_distinct= 0;
+  }
+
+  ulonglong get_count_distinct() { return count_distinct; }
+
+  int next(void *elem, element_count elem_cnt)
+  {
+    count_distinct++;
+    count+= elem_cnt;
+    column->store_field_value((uchar *) elem, col_length);
+    double pos= column->pos_in_interval(min_value, max_value);
+
+    Fine_bucket *bucket= &fine[curr_fine];
+    bucket->end= pos;
+    bucket->rows+= elem_cnt;
+    bucket->distinct++;
+
+    if (max_candidates)
+    {
+      uint i= n_candidates;
+      if (n_candidates == max_candidates)
+      {
+        /* Replace the least common of the candidates if it is less common */
+        uint least= 0;
+        for (uint j= 1; j < n_candidates; j++)
+        {
+          if (candidates[j].rows < candidates[least].rows)
+            least= j;
+        }
+        i= candidates[least].rows < elem_cnt ? least : max_candidates;
+      }
+      if (i < max_candidates)
+      {
+        char buff[MAX_FIELD_WIDTH];
+        String val(buff, sizeof(buff), column->charset());
+        String *res= column->val_str(&val);
+        if (res->length() < Histogram::MCV_MAX_TEXT_LENGTH)
+        {
+          if (i == n_candidates)
+            n_candidates++;
+          candidates[i].number= count_distinct;
+          candidates[i].pos= pos;
+          candidates[i].rows= elem_cnt;
+          candidates[i].fine_bucket= curr_fine;
+          candidates[i].text_length= res->length();
+          memcpy(candidates[i].text, res->ptr(), res->length());
+        }
+      }
+    }
+
+    if (count >= fine_capacity * (curr_fine + 1) &&
+        curr_fine < FINE_BUCKETS - 1)
+    {
+      if (fine_texts)
+        set_end_text(bucket);
+      curr_fine++;
+    }
+    return 0;
+  }
+
+  /* Write the histogram when all the values have been walked */
+  void finish()
+  {
+    uchar *values= histogram->get_values();
+    uint size= histogram->get_size();
+    histogram->set_text_size(0);
+    if (size < Histogram::MCV_HEADER_SIZE || !count_distinct || !fine_texts)
+      return;
+
+    /* The last value walked is still in the record of the column */
+    set_end_text(&fine[curr_fine]);
+
+    /*
+      Only the values that occur more than twice as often as the average
+      value are worth a place of their own.
+    */
+    double avg_rows= (double) count / count_distinct;
+    uint n_values= 0;
+    uint text_size= 0;
+    for (uint i= 0; i < n_candidates; i++)
+    {
+      if (candidates[i].rows > 2 * avg_rows)
+      {
+        text_size+= candidates[i].text_length + 1;
+        candidates[n_values++]= candidates[i];
+      }
+    }
+    /* Order the values as they were walked, i.e. in ascending order */
+    for (uint i= 1; i < n_values; i++)
+    {
+      for (uint j= i; j && candidates[j].number < candidates[j - 1].number;
+           j--)
+        swap_variables(Candidate, candidates[j], candidates[j - 1]);
+    }
+
+    ulonglong rest= count;
+    for (uint i= 0; i < n_values; i++)
+    {
+      Candidate *value= &candidates[i];
+      uchar *ptr= values + Histogram::MCV_HEADER_SIZE +
+                  i * Histogram::MCV_VALUE_SIZE;
+      int2store(ptr, (uint16) (value->pos * 65535));
+      int2store(ptr + 2, to_share((double) value->rows / count));
+      fine[value->fine_bucket].rows-= value->rows;
+      fine[value->fine_bucket].distinct--;
+      rest-= value->rows;
+    }
+
+    uint n_buckets= MY_MIN(255, (size - Histogram::MCV_HEADER_SIZE -
+                                 n_values * Histogram::MCV_VALUE_SIZE) /
+                                Histogram::MCV_BUCKET_SIZE);
+    uchar *ptr= values + Histogram::MCV_HEADER_SIZE +
+                n_values * Histogram::MCV_VALUE_SIZE;
+    Fine_bucket *ends[255];
+    uint bucket= 0;
+    if (n_buckets && rest)
+    {
+      double bucket_capacity= (double) rest / n_buckets;
+      ulonglong rows= 0, distinct= 0, total= 0;
+      Fine_bucket *end= NULL;
+      for (uint i= 0; i <= curr_fine; i++)
+      {
+        if (!fine[i].rows)
+          continue;
+        rows+= fine[i].rows;
+        distinct+= fine[i].distinct;
+        total+= fine[i].rows;
+        end= &fine[i];
+        if (total >= bucket_capacity * (bucket + 1) && bucket < n_buckets - 1)
+        {
+          int2store(ptr, (uint16) (end->end * 65535));
+          int2store(ptr + 2, to_share((double) rows / count));
+          ptr[4]= (uchar) MY_MIN(distinct, 255);
+          ptr+= Histogram::MCV_BUCKET_SIZE;
+          ends[bucket++]= end;
+          rows= distinct= 0;
+        }
+      }
+      if (rows)
+      {
+        int2store(ptr, (uint16) (end->end * 65535));
+        int2store(ptr + 2, to_share((double) rows / count));
+        ptr[4]= (uchar) MY_MIN(distinct, 255);
+        ends[bucket++]= end;
+      }
+    }
+    for (uint i= 0; i < bucket; i++)
+      text_size+= ends[i]->text_length + 1;
+
+    /* The texts of the values and of the bucket ends follow the histogram */
+    uchar *texts;
+    if (!(texts= (uchar *) alloc_root(&column->table->mem_root,
+                                      size + text_size)))
+    {
+      values[0]= values[1]= 0;
+      return;
+    }
+    values[0]= (uchar) n_values;
+    values[1]= (uchar) bucket;
+    memcpy(texts, values, size);
+    uchar *text= texts + size;
+    for (uint i= 0; i < n_values; i++)
+    {
+      text[0]= (uchar) candidates[i].text_length;
+      memcpy(text + 1, candidates[i].text, candidates[i].text_length);
+      text+= candidates[i].text_length + 1;
+    }
+    for (uint i= 0; i < bucket; i++)
+    {
+      text[0]= (uchar) ends[i]->text_length;
+      memcpy(text + 1, ends[i]->text, ends[i]->text_length);
+      text+= ends[i]->text_length + 1;
+    }
+    histogram->set_values(texts);
+    histogram->set_text_size(text_size);
+  }
+};
+
+
+C_MODE_START
+
+int mcv_histogram_build_walk(void *elem, element_count elem_cnt, void *arg)
+{
+  Mcv_histogram_builder *hist_builder= (Mcv_histogram_builder *) arg;
+  return hist_builder->next(elem, elem_cnt);
+}
+
+C_MODE_END
+
+
 /*
   The class Count_distinct_field is a helper class used to calculate
   the number of distinct values for a column. The class employs the
@@ -1682,6 +1982,14 @@ class Count_distinct_field: public Sql_alloc
   */
   ulonglong get_value_with_histogram(ha_rows rows)
   {
+    if (table_field->collected_stats->histogram.get_type() == MCV_HB)
+    {
+      Mcv_histogram_builder hist_builder(table_field, tree_key_length, rows);
+      tree->walk(table_field->table, mcv_histogram_build_walk,
+                 (void *) &hist_builder);
+      hist_builder.finish();
+      return hist_builder.get_count_distinct();
+    }
     Histogram_builder hist_builder(table_field, tree_key_length, rows);
     tree->walk(table_field->table,  histogram_build_walk, (void *) &hist_builder);
     return hist_builder.get_count_distinct();
@@ -2982,7 +3290,8 @@ int read_statistics_for_table(THD *thd, TABLE *table, TABLE_LIST *stat_tables)
     table_field= *field_ptr;
     column_stat.set_key_fields(table_field);
     column_stat.get_stat_values();
-    total_hist_size+= table_field->read_stats->histogram.get_size();
+    total_hist_size+= table_field->read_stats->histogram.get_size() +
+                      table_field->read_stats->histogram.get_text_size();
   }
   read_stats->total_hist_size= total_hist_size;
 
@@ -3179,7 +3488,8 @@ int read_histograms_for_table(THD *thd, TABLE *table, TABLE_LIST *stat_tables)
         column_stat.set_key_fields(table_field);
         table_field->read_stats->histogram.set_values(histogram);
         column_stat.get_histogram_value();
-        histogram+= hist_size;
+        histogram+= hist_size +
+                    table_field->read_stats->histogram.get_text_size();
       }
     }
   }
@@ -3814,9 +4124,13 @@ double get_column_range_cardinality(Field *field,
                                  field->key_length());
           double pos= field->pos_in_interval(col_stats->min_value,
                                              col_stats->max_value);
-          res= col_non_nulls * 
-	       hist->point_selectivity(pos,
-                                       avg_frequency / col_non_nulls);
+          double avg_sel= avg_frequency / col_non_nulls;
+          if (hist->get_type() == MCV_HB)
+            res= col_non_nulls *
+                 hist->mcv_point_selectivity(field, min_endp, pos, avg_sel);
+          else
+            res= col_non_nulls * 
+	         hist->point_selectivity(field, pos, avg_sel);
         }
       }
       else if (avg_frequency == 0.0)
@@ -3840,7 +4154,10 @@ double get_column_range_cardinality(Field *field,
                                            col_stats->max_value);
       }
       else
+      {
+        min_endp= NULL;
         min_mp_pos= 0.0;
+      }
       if (max_endp)
       {
         store_key_image_to_rec(field, (uchar *) max_endp->key,
@@ -3854,6 +4171,9 @@ double get_column_range_cardinality(Field *field,
       Histogram *hist= &col_stats->histogram;
       if (!hist->is_available())
         sel= (max_mp_pos - min_mp_pos);
+      else if (hist->get_type() == MCV_HB)
+        sel= hist->mcv_range_selectivity(field, min_endp, max_endp,
+                                         range_flag, min_mp_pos, max_mp_pos);
       else
         sel= hist->range_selectivity(min_mp_pos, max_mp_pos);
       res= col_non_nulls * sel;
@@ -3872,6 +4192,7 @@ double get_column_range_cardinality(Field *field,
 /*
   Estimate selectivity of "col=const" using a histogram
   
+  @param field    The column, with the "const" stored in its record
   @param pos      Position of the "const" between column's min_value and 
                   max_value.  This is a number in [0..1] range.
   @param avg_sel  Average selectivity of condition "col=const" in this table.
@@ -3902,9 +4223,10 @@ double get_column_range_cardinality(Field *field,
       value.
 */
 
-double Histogram::point_selectivity(double pos, double avg_sel)
+double Histogram::point_selectivity(Field *field, double pos, double avg_sel)
 {
   double sel;
+  DBUG_ASSERT(type != MCV_HB);                  // See mcv_point_selectivity()
   /* Find the bucket that contains the value 'pos'. */
   uint min= find_bucket(pos, TRUE);
   uint pos_value= (uint) (pos * prec_factor());
@@ -3983,6 +4305,183 @@ double Histogram::point_selectivity(double pos, double avg_sel)
   return sel;
 }
 
+
+/*
+  Compare a value of a histogram of the type MCV_HB with an end of a range
+
+  @param field      The column
+  @param text       The length and the text of the value
+  @param pos_value  The position of the value, in units of 1/prec_factor()
+  @param endp       The end of the range
+  @param endp_value The position of the end of the range, as above
+
+  @details
+    The position of a value does not decrease as the value grows, so the
+    value and the end of the range are compared only when their positions
+    are the same. Then the text of the value is stored into the record of
+    the column and compared with the end of the range.
+
+  @return
+    -1, 0 or 1 as the value is less than, equal to or greater than the end
+    of the range, MCV_CMP_UNKNOWN if the text of the value may have been cut
+*/
+
+int Histogram::mcv_cmp(Field *field, const uchar *text, uint pos_value,
+                       key_range *endp, uint endp_value)
+{
+  if (pos_value != endp_value)
+    return pos_value < endp_value ? -1 : 1;
+  if (text[0] >= MCV_MAX_TEXT_LENGTH)
+    return MCV_CMP_UNKNOWN;
+
+  TABLE *table= field->table;
+  THD *thd= table->in_use;
+  enum_check_fields save_count_cuted_fields= thd->count_cuted_fields;
+  thd->count_cuted_fields= CHECK_FIELD_IGNORE;
+  my_bitmap_map *old_map= dbug_tmp_use_all_columns(table, table->write_set);
+  field->set_notnull();
+  field->store((const char *) text + 1, text[0], field->charset());
+  dbug_tmp_restore_column_map(table->write_set, old_map);
+  thd->count_cuted_fields= save_count_cuted_fields;
+
+  const uchar *key= endp->key;
+  if (field->real_maybe_null())
+    key++;
+  int res= field->key_cmp(key, field->key_length());
+  return res < 0 ? -1 : res > 0;
+}
+
+
+/*
+  Estimate selectivity of "col=const" using a histogram of the type MCV_HB
+
+  @param field    The column
+  @param endp     The "const"
+  @param pos      Position of the "const" between column's min_value and
+                  max_value
+  @param avg_sel  Average selectivity of condition "col=const" in this table
+
+  @details
+    The share of a most common value is stored in the histogram. Any other
+    value is assumed to have the average frequency of the distinct values
+    in its bucket.
+*/
+
+double Histogram::mcv_point_selectivity(Field *field, key_range *endp,
+                                        double pos, double avg_sel)
+{
+  double inv_prec_factor= (double) 1.0 / prec_factor();
+  uint pos_value= (uint) (pos * prec_factor());
+
+  uchar *text= mcv_texts();
+  for (uint i= 0; i < mcv_values(); i++, text+= text[0] + 1)
+  {
+    uchar *value= mcv_value(i);
+    if (!mcv_cmp(field, text, uint2korr(value), endp, pos_value))
+      return uint2korr(value + 2) * inv_prec_factor;
+  }
+  for (uint i= 0; i < mcv_buckets(); i++, text+= text[0] + 1)
+  {
+    uchar *bucket= mcv_bucket(i);
+    if (mcv_cmp(field, text, uint2korr(bucket), endp, pos_value) >= 0)
+    {
+      uint distinct= bucket[4];
+      if (!distinct)
+        break;
+      double sel= uint2korr(bucket + 2) * inv_prec_factor / distinct;
+      /* 255 means that there are at least that many distinct values */
+      if (distinct == 255)
+        set_if_smaller(sel, avg_sel);
+      return sel;
+    }
+  }
+  return avg_sel;
+}
+
+
+/*
+  Estimate selectivity of a range using a histogram of the type MCV_HB
+
+  @param field       The column
+  @param min_endp    The left end of the range, NULL if there is none
+  @param max_endp    The right end of the range, NULL if there is none
+  @param range_flag  The range flags
+  @param min_pos     Position of the left end of the range
+  @param max_pos     Position of the right end of the range
+
+  @details
+    The shares of the most common values within the range are added to the
+    shares of the buckets that are within the range. A bucket that is
+    partly within the range adds the part of its share that the range
+    covers between the positions of its ends, or half of its share if all
+    of its values are at the same position.
+*/
+
+double Histogram::mcv_range_selectivity(Field *field, key_range *min_endp,
+                                        key_range *max_endp, uint range_flag,
+                                        double min_pos, double max_pos)
+{
+  double inv_prec_factor= (double) 1.0 / prec_factor();
+  uint min_value= (uint) (min_pos * prec_factor());
+  uint max_value= (uint) (max_pos * prec_factor());
+  double sel= 0.0;
+
+  uchar *text= mcv_texts();
+  for (uint i= 0; i < mcv_values(); i++, text+= text[0] + 1)
+  {
+    uchar *value= mcv_value(i);
+    uint pos_value= uint2korr(value);
+    int cmp_min= min_endp ?
+                 mcv_cmp(field, text, pos_value, min_endp, min_value) : 1;
+    int cmp_max= max_endp ?
+                 mcv_cmp(field, text, pos_value, max_endp, max_value) : -1;
+    if ((cmp_min > 0 || (!cmp_min && !(range_flag & NEAR_MIN))) &&
+        (cmp_max < 0 || (!cmp_max && !(range_flag & NEAR_MAX))))
+      sel+= uint2korr(value + 2) * inv_prec_factor;
+  }
+
+  /*
+    A bucket holds the values above the end of the previous bucket up to
+    its own end. The first bucket starts with the minimal value.
+  */
+  double start= 0.0;
+  int start_cmp_min= min_endp ? MCV_CMP_UNKNOWN : 1;
+  int start_cmp_max= max_endp ? MCV_CMP_UNKNOWN : -1;
+  for (uint i= 0; i < mcv_buckets(); i++, text+= text[0] + 1)
+  {
+    uchar *bucket= mcv_bucket(i);
+    uint end_value= uint2korr(bucket);
+    double end= end_value * inv_prec_factor;
+    double share= uint2korr(bucket + 2) * inv_prec_factor;
+    int end_cmp_min= min_endp ?
+                     mcv_cmp(field, text, end_value, min_endp, min_value) : 1;
+    int end_cmp_max= max_endp ?
+                     mcv_cmp(field, text, end_value, max_endp, max_value) : -1;
+
+    bool below= end_cmp_min < 0 || (!end_cmp_min && (range_flag & NEAR_MIN));
+    bool above= start_cmp_max >= 0 && start_cmp_max != MCV_CMP_UNKNOWN;
+    if (!below && !above)
+    {
+      if (start_cmp_min >= 0 && start_cmp_min != MCV_CMP_UNKNOWN &&
+          (end_cmp_max < 0 || (!end_cmp_max && !(range_flag & NEAR_MAX))))
+        sel+= share;
+      else if (end > start)
+      {
+        double covered= MY_MIN(end, max_pos) - MY_MAX(start, min_pos);
+        if (covered > 0)
+          sel+= share * covered / (end - start);
+      }
+      else
+        sel+= share / 2;
+    }
+    start= end;
+    start_cmp_min= end_cmp_min;
+    start_cmp_max= end_cmp_max;
+  }
+  return MY_MIN(sel, 1.0);
+}
+
+
 /*
   Check whether the table is one of the persistent statistical tables.
 */
@@ -28,7 +28,8 @@ typedef
 enum enum_histogram_type
 {
   SINGLE_PREC_HB,
-  DOUBLE_PREC_HB
+  DOUBLE_PREC_HB,
+  MCV_HB
 } Histogram_type;
 
 enum enum_stat_tables
@@ -118,6 +119,7 @@ class Histogram
 private:
   Histogram_type type;
   uint8 size; /* Size of values array, in bytes */
+  uint text_size; /* Size of the texts that follow values, in bytes */
   uchar *values;
 
   uint prec_factor()
@@ -126,6 +128,7 @@ class Histogram
     case SINGLE_PREC_HB:
       return ((uint) (1 << 8) - 1);
     case DOUBLE_PREC_HB:
+    case MCV_HB:
       return ((uint) (1 << 16) - 1);
     }
     return 1;
@@ -139,6 +142,8 @@ class Histogram
       return size;
     case DOUBLE_PREC_HB:
       return size / 2;
+    case MCV_HB:
+      return mcv_buckets();
     }
     return 0;
   }
@@ -152,10 +157,51 @@ class Histogram
       return (uint) (((uint8 *) values)[i]);
     case DOUBLE_PREC_HB:
       return (uint) uint2korr(values + i * 2);
+    case MCV_HB:
+      return (uint) uint2korr(mcv_bucket(i));
     }
     return 0;
   }
 
+  /*
+    A histogram of the type MCV_HB consists of
+    - the number of most common values (1 byte)
+    - the number of buckets (1 byte)
+    - for each most common value, in ascending order of the values:
+      its position in [min_value, max_value] and its share of the non-null
+      rows (2 bytes each, in units of 1/65535)
+    - for each bucket of the remaining values, in ascending order:
+      the position of the largest value in the bucket and the share of the
+      non-null rows in the bucket (2 bytes each, as above) and the number
+      of distinct values in the bucket (1 byte, at most 255)
+    The buckets are built to contain the same number of rows, but their
+    shares are stored because a value that is not among the most common
+    ones can still overflow a bucket.
+    The histogram is followed by the texts of the most common values and
+    then by the texts of the ends of the buckets, in the same order, each
+    as its length (1 byte) and the result of val_str() of the column.
+    Different values can be at the same position, so when a constant is at
+    the position of a value of the histogram, the two are compared by the
+    text of the value (see mcv_cmp()). A text of MCV_MAX_TEXT_LENGTH bytes
+    may have been cut: the text of a bucket end is cut to that length, and
+    a value with a text that long is never taken for a most common one.
+  */
+  enum { MCV_HEADER_SIZE= 2, MCV_VALUE_SIZE= 4, MCV_BUCKET_SIZE= 5,
+         MCV_MAX_TEXT_LENGTH= 255, MCV_CMP_UNKNOWN= 2 };
+
+  uint mcv_values() { return values[0]; }
+  uint mcv_buckets() { return values[1]; }
+  uchar *mcv_value(uint i)
+  { return values + MCV_HEADER_SIZE + i * MCV_VALUE_SIZE; }
+  uchar *mcv_bucket(uint i)
+  {
+    return values + MCV_HEADER_SIZE + mcv_values() * MCV_VALUE_SIZE +
+           i * MCV_BUCKET_SIZE;
+  }
+  uchar *mcv_texts() { return values + size; }
+  int mcv_cmp(Field *field, const uchar *text, uint pos_value,
+              key_range *endp, uint endp_value);
+
   /* Find the bucket which value 'pos' falls into. */
   uint find_bucket(double pos, bool first)
   {
@@ -209,7 +255,36 @@ class Histogram
 
   void set_values (uchar *vals) { values= (uchar *) vals; }
 
-  bool is_available() { return get_size() > 0 && get_values(); }
+  uint get_text_size() { return text_size; }
+
+  void set_text_size (uint sz) { text_size= sz; }
+
+  bool is_available()
+  {
+    if (!get_size() || !get_values())
+      return FALSE;
+    if (type != MCV_HB)
+      return TRUE;
+    /*
+      The counts of a histogram read from the table must fit its size,
+      and a histogram that is too small to hold a value or a bucket says
+      nothing about the distribution.
+    */
+    if (get_size() < MCV_HEADER_SIZE ||
+        (!mcv_values() && !mcv_buckets()) ||
+        MCV_HEADER_SIZE + mcv_values() * MCV_VALUE_SIZE +
+        mcv_buckets() * MCV_BUCKET_SIZE > get_size())
+      return FALSE;
+    /* Every most common value and every bucket end must have its text */
+    uint text_offset= 0;
+    for (uint i= 0; i < mcv_values() + mcv_buckets(); i++)
+    {
+      if (text_offset >= text_size)
+        return FALSE;
+      text_offset+= mcv_texts()[text_offset] + 1;
+    }
+    return text_offset <= text_size;
+  }
 
   void set_value(uint i, double val)
   {
@@ -220,6 +295,9 @@ class Histogram
     case DOUBLE_PREC_HB:
       int2store(values + i * 2, val * prec_factor());
       return;
+    case MCV_HB:
+      DBUG_ASSERT(0);                           // See Mcv_histogram_builder
+      return;
     }
   }
 
@@ -232,12 +310,16 @@ class Histogram
     case DOUBLE_PREC_HB:
       int2store(values + i * 2, uint2korr(values + i * 2 - 2));
       return;
+    case MCV_HB:
+      DBUG_ASSERT(0);
+      return;
     }
   }
 
   double range_selectivity(double min_pos, double max_pos)
   {
     double sel;
+    DBUG_ASSERT(type != MCV_HB);                // See mcv_range_selectivity()
     double bucket_sel= 1.0/(get_width() + 1);  
     uint min= find_bucket(min_pos, TRUE);
     uint max= find_bucket(max_pos, FALSE);
@@ -248,7 +330,19 @@ class Histogram
   /*
     Estimate selectivity of "col=const" using a histogram
   */
-  double point_selectivity(double pos, double avg_sel);
+  double point_selectivity(Field *field, double pos, double avg_sel);
+
+  /*
+    Estimate selectivity of "col=const" and of ranges using a histogram of
+    the type MCV_HB
+  */
+  double mcv_point_selectivity(Field *field, key_range *endp, double pos,
+                               double avg_sel);
+  double mcv_range_selectivity(Field *field, key_range *min_endp,
+                               key_range *max_endp, uint range_flag,
+                               double min_pos, double max_pos);
+
+  friend class Mcv_histogram_builder;
 };
 
 
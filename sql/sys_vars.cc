@@ -2472,6 +2472,7 @@ export const char *optimizer_switch_names[]=
   "orderby_uses_equalities",
   "condition_pushdown_for_derived",
   "split_materialized",
+  "join_cache_rescan_file",
   "default", 
   NullS
 };
@@ -2861,6 +2862,14 @@ static Sys_var_ulong Sys_query_cache_min_res_unit(
        BLOCK_SIZE(8), NO_MUTEX_GUARD, NOT_IN_BINLOG, ON_CHECK(0),
        ON_UPDATE(fix_qcache_min_res_unit));
 
+static Sys_var_mybool Sys_query_cache_lazy_invalidation(
+       "query_cache_lazy_invalidation",
+       "Only mark the cached queries of a changed table as stale, and "
+       "remove them when they are looked up again or their memory is "
+       "needed, so that writes do not wait for the query cache lock",
+       GLOBAL_VAR(opt_query_cache_lazy_invalidation), CMD_LINE(OPT_ARG),
+       DEFAULT(FALSE));
+
 static const char *query_cache_type_names[]= { "OFF", "ON", "DEMAND", 0 };
 
 static bool check_query_cache_type(sys_var *self, THD *thd, set_var *var)
@@ -3232,6 +3241,22 @@ static Sys_var_ulong Sys_slow_launch_time(
        GLOBAL_VAR(slow_launch_time), CMD_LINE(REQUIRED_ARG),
        VALID_RANGE(0, LONG_TIMEOUT), DEFAULT(2), BLOCK_SIZE(1));
 
+static Sys_var_ulong Sys_filesort_max_threads(
+       "filesort_max_threads",
+       "The maximum number of threads that all filesorts of the server may "
+       "run at the same time in addition to the connection threads. "
+       "0 means that the keys are always sorted by the connection thread",
+       GLOBAL_VAR(filesort_max_threads), CMD_LINE(REQUIRED_ARG),
+       VALID_RANGE(0, 1024), DEFAULT(16), BLOCK_SIZE(1));
+
+static Sys_var_ulong Sys_filesort_threads(
+       "filesort_threads",
+       "The number of threads that sort the keys of one sort buffer of "
+       "filesort and merge the sorted parts. 1 means that the keys are "
+       "sorted by the connection thread",
+       SESSION_VAR(filesort_threads), CMD_LINE(REQUIRED_ARG),
+       VALID_RANGE(1, MAX_FILESORT_THREADS), DEFAULT(1), BLOCK_SIZE(1));
+
 static Sys_var_ulonglong Sys_sort_buffer(
        "sort_buffer_size",
        "Each thread that needs to do a sort allocates a buffer of this size",
@@ -5798,7 +5823,9 @@ static Sys_var_enum Sys_histogram_type(
        "Specifies type of the histograms created by ANALYZE. "
        "Possible values are: "
        "SINGLE_PREC_HB - single precision height-balanced, "
-       "DOUBLE_PREC_HB - double precision height-balanced.",
+       "DOUBLE_PREC_HB - double precision height-balanced, "
+       "MCV_HB - double precision height-balanced with the most common "
+       "values and the number of distinct values in each bucket.",
        SESSION_VAR(histogram_type), CMD_LINE(REQUIRED_ARG),
        histogram_types, DEFAULT(0));
 
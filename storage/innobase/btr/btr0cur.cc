@@ -99,8 +99,9 @@ operations by purge as the previous, when it seems to be growing huge.
 throughput clearly from about 100000. */
 #define BTR_CUR_FINE_HISTORY_LENGTH	100000
 
-/** Number of searches down the B-tree in btr_cur_search_to_nth_level(). */
-ulint	btr_cur_n_non_sea;
+/** Number of searches down the B-tree in btr_cur_search_to_nth_level().
+Sharded, so that concurrent searches do not contend on one cache line. */
+ib_counter_t<ulint, 64>	btr_cur_n_non_sea;
 /** Old value of btr_cur_n_non_sea.  Copied by
 srv_refresh_innodb_monitor_stats().  Referenced by
 srv_printf_innodb_monitor(). */
@@ -108,7 +109,7 @@ ulint	btr_cur_n_non_sea_old;
 #ifdef BTR_CUR_HASH_ADAPT
 /** Number of successful adaptive hash index lookups in
 btr_cur_search_to_nth_level(). */
-ulint	btr_cur_n_sea;
+ib_counter_t<ulint, 64>	btr_cur_n_sea;
 /** Old value of btr_cur_n_sea.  Copied by
 srv_refresh_innodb_monitor_stats().  Referenced by
 srv_printf_innodb_monitor(). */
@@ -1089,6 +1090,7 @@ btr_cur_search_to_nth_level_func(
 
 	cursor->flag = BTR_CUR_BINARY;
 	cursor->index = index;
+	cursor->parent_page_no = FIL_NULL;
 
 #ifndef BTR_CUR_ADAPT
 	guess = NULL;
@@ -1135,13 +1137,22 @@ btr_cur_search_to_nth_level_func(
 		      || mode != PAGE_CUR_LE);
 		ut_ad(cursor->low_match != ULINT_UNDEFINED
 		      || mode != PAGE_CUR_LE);
-		btr_cur_n_sea++;
+		btr_cur_n_sea.inc();
+
+		if (btr_search_sampled()) {
+			info->n_hash_searches++;
+		}
 
 		DBUG_RETURN(err);
 	}
 # endif /* BTR_CUR_HASH_ADAPT */
 #endif /* BTR_CUR_ADAPT */
-	btr_cur_n_non_sea++;
+	btr_cur_n_non_sea.inc();
+#ifdef BTR_CUR_HASH_ADAPT
+	if (btr_search_sampled()) {
+		info->n_btree_searches++;
+	}
+#endif /* BTR_CUR_HASH_ADAPT */
 
 	/* If the hash search did not succeed, do binary search down the
 	tree */
@@ -1742,6 +1753,10 @@ btr_cur_search_to_nth_level_func(
 		height--;
 		guess = NULL;
 
+		if (height == 0) {
+			cursor->parent_page_no = block->page.id.page_no();
+		}
+
 		node_ptr = page_cur_get_rec(page_cursor);
 
 		offsets = rec_get_offsets(node_ptr, index, offsets, false,
@@ -2331,6 +2346,7 @@ btr_cur_open_at_index_side_func(
 
 	page_cursor = btr_cur_get_page_cur(cursor);
 	cursor->index = index;
+	cursor->parent_page_no = FIL_NULL;
 
 	page_id_t		page_id(index->table->space->id, index->page);
 	const page_size_t	page_size(index->table->space->flags);
@@ -2513,6 +2529,10 @@ btr_cur_open_at_index_side_func(
 
 		height--;
 
+		if (height == 0) {
+			cursor->parent_page_no = block->page.id.page_no();
+		}
+
 		node_ptr = page_cur_get_rec(page_cursor);
 		offsets = rec_get_offsets(node_ptr, cursor->index, offsets,
 					  false, ULINT_UNDEFINED, &heap);
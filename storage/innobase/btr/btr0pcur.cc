@@ -28,6 +28,7 @@ Created 2/23/1996 Heikki Tuuri
 #include "ut0byte.h"
 #include "rem0cmp.h"
 #include "trx0trx.h"
+#include "buf0rea.h"
 
 /**************************************************************//**
 Allocates memory for a persistent cursor object and initializes the cursor.
@@ -465,6 +466,109 @@ btr_pcur_move_to_next_page(
 	ut_d(page_check_dir(next_page));
 }
 
+/** Issue asynchronous reads for the leaf pages that follow the current
+page of an ascending index scan, as named by the node pointers of the
+parent page. Because the cursor is holding a latch on the child page,
+the parent page is only latched if that is possible without waiting.
+@param[in]	cursor	persistent cursor, positioned on a leaf page
+@param[in,out]	parent	page number of the parent page, or FIL_NULL to
+			use the page that the last search of the cursor
+			passed through; set to the page where the node pointer
+			to the current page was found, or to FIL_NULL
+@param[in]	n_pages	number of pages to read ahead
+@return the read-ahead page on whose access this function should be
+invoked again, or FIL_NULL */
+ulint
+btr_pcur_read_ahead(const btr_pcur_t* cursor, ulint* parent, ulint n_pages)
+{
+	const buf_block_t*	block = btr_pcur_get_block(cursor);
+	const dict_index_t*	index = cursor->index();
+	const ulint		space_id = block->page.id.space();
+	const ulint		leaf_page_no = block->page.id.page_no();
+	ulint			page_nos[BUF_READ_AHEAD_RANGE_MAX];
+	ulint			n = 0;
+	bool			found = false;
+	mem_heap_t*		heap = NULL;
+	ulint			offsets_[REC_OFFS_NORMAL_SIZE];
+	ulint*			offsets = offsets_;
+	rec_offs_init(offsets_);
+
+	ut_ad(cursor->pos_state == BTR_PCUR_IS_POSITIONED);
+	ut_ad(page_is_leaf(block->frame));
+	ut_ad(n_pages > 0);
+	ut_ad(n_pages <= BUF_READ_AHEAD_RANGE_MAX);
+
+	ulint	parent_page_no = *parent;
+
+	if (parent_page_no == FIL_NULL) {
+		parent_page_no = cursor->btr_cur.parent_page_no;
+	}
+
+	*parent = FIL_NULL;
+
+	/* The node pointer to the current page may have moved to the
+	right sibling of the parent page by a page split, and the pages
+	to read ahead may continue there. */
+	for (ulint i = 0;
+	     i < 2 && parent_page_no != FIL_NULL && n < n_pages; i++) {
+		mtr_t	mtr;
+
+		mtr.start();
+
+		/* The parent page may have been freed since the search. */
+		const buf_block_t*	parent_block = buf_page_try_get_func(
+			page_id_t(space_id, parent_page_no),
+			__FILE__, __LINE__, &mtr, true);
+		const page_t*		page = parent_block
+			? buf_block_get_frame(parent_block) : NULL;
+
+		if (!page
+		    || !fil_page_index_page_check(page)
+		    || btr_page_get_index_id(page) != index->id
+		    || btr_page_get_level(page) != 1) {
+			mtr.commit();
+			break;
+		}
+
+		for (const rec_t* rec = page_rec_get_next_const(
+			     page_get_infimum_rec(page));
+		     !page_rec_is_supremum(rec) && n < n_pages;
+		     rec = page_rec_get_next_const(rec)) {
+			offsets = rec_get_offsets(rec, index, offsets, false,
+						  ULINT_UNDEFINED, &heap);
+
+			const ulint	child = btr_node_ptr_get_child_page_no(
+				rec, offsets);
+
+			if (found) {
+				page_nos[n++] = child;
+			} else if (child == leaf_page_no) {
+				found = true;
+				*parent = parent_page_no;
+			}
+		}
+
+		parent_page_no = btr_page_get_next(page, &mtr);
+
+		mtr.commit();
+	}
+
+	if (heap != NULL) {
+		mem_heap_free(heap);
+	}
+
+	if (n == 0) {
+		return(FIL_NULL);
+	}
+
+	buf_read_ahead_range(space_id, block->page.size, page_nos, n);
+
+	/* Read further ahead once the scan has reached the middle of
+	this batch, so that the reads can complete before the scan
+	reaches the end of it. */
+	return(page_nos[(n - 1) / 2]);
+}
+
 /*********************************************************//**
 Moves the persistent cursor backward if it is on the first record of the page.
 Commits mtr. Note that to prevent a possible deadlock, the operation
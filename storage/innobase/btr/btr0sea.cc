@@ -1053,14 +1053,18 @@ btr_search_guess_on_hash(
 	fail if the page of the cursor gets removed from the buffer pool
 	meanwhile! Thus it might not be a bug. */
 #endif
-	info->last_hash_succ = TRUE;
+	/* Avoid dirtying the cache line of the search info on every
+	successful lookup. */
+	if (!info->last_hash_succ) {
+		info->last_hash_succ = TRUE;
+	}
 
 #ifdef UNIV_SEARCH_PERF_STAT
 	btr_search_n_succ++;
 #endif
 	if (!ahi_latch && buf_page_peek_if_too_old(&block->page)) {
 
-		buf_page_make_young(&block->page);
+		buf_page_make_young_deferred(&block->page);
 	}
 
 	/* Increment the page get statistics though we did not really
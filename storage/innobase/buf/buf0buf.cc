@@ -81,6 +81,9 @@ Created 11/5/1995 Heikki Tuuri
 
 #ifdef UNIV_LINUX
 #include <stdlib.h>
+#ifdef LINUX_IO_URING
+#include <sys/uio.h>
+#endif /* LINUX_IO_URING */
 #endif
 
 #ifdef HAVE_LZO
@@ -2029,6 +2032,34 @@ buf_pool_free_instance(
 	buf_pool->allocator.~ut_allocator();
 }
 
+#ifdef LINUX_IO_URING
+/** Register the memory of all buffer pool chunks for io_uring fixed
+buffer I/O, so that the kernel does not have to map the page frames
+for each read and write. */
+static
+void
+buf_pool_register_io_buffers()
+{
+	std::vector<iovec, ut_allocator<iovec> >	bufs;
+
+	for (ulint i = 0; i < srv_buf_pool_instances; i++) {
+		const buf_pool_t*	buf_pool = buf_pool_from_array(i);
+		const buf_chunk_t*	chunk = buf_pool->chunks;
+
+		for (ulint j = 0; j < buf_pool->n_chunks; j++, chunk++) {
+			iovec	buf;
+
+			buf.iov_base = chunk->mem;
+			buf.iov_len = chunk->mem_size();
+
+			bufs.push_back(buf);
+		}
+	}
+
+	os_aio_register_buffers(bufs.empty() ? NULL : &bufs[0], bufs.size());
+}
+#endif /* LINUX_IO_URING */
+
 /********************************************************************//**
 Creates the buffer pool.
 @return DB_SUCCESS if success, DB_ERROR if not enough memory or error */
@@ -2075,6 +2106,10 @@ buf_pool_init(
 
 	btr_search_sys_create(buf_pool_get_curr_size() / sizeof(void*) / 64);
 
+#ifdef LINUX_IO_URING
+	buf_pool_register_io_buffers();
+#endif /* LINUX_IO_URING */
+
 	return(DB_SUCCESS);
 }
 
@@ -2990,6 +3025,10 @@ buf_pool_resize()
 	buf_pool_chunk_map_t*	chunk_map_old = buf_chunk_map_ref;
 	buf_chunk_map_ref = buf_chunk_map_reg;
 
+#ifdef LINUX_IO_URING
+	buf_pool_register_io_buffers();
+#endif /* LINUX_IO_URING */
+
 	/* set instance sizes */
 	{
 		ulint	curr_size = 0;
@@ -3636,6 +3675,48 @@ buf_page_make_young(
 	buf_pool_mutex_exit(buf_pool);
 }
 
+/** Request a page to be moved to the start of the buffer pool LRU list
+without acquiring buf_pool->mutex. The move is carried out by
+buf_LRU_make_queued_young() before the next LRU scan or LRU flush batch
+of the buffer pool instance; if the queue overflows before that,
+the oldest requests are forgotten.
+@param[in]	bpage	buffer-fixed or latched file page */
+void
+buf_page_make_young_deferred(const buf_page_t* bpage)
+{
+	buf_pool_t*	buf_pool = buf_pool_from_bpage(bpage);
+
+	ut_ad(buf_page_in_file(bpage));
+
+	/* FIL_NULL is never a valid page number, so that the packed
+	identifier cannot wrap around to 0 (an empty slot). */
+	const ib_uint64_t	id = ((ib_uint64_t(bpage->id.space()) << 32)
+				      | bpage->id.page_no()) + 1;
+
+	/* A hot page in the old sublist may be found too old by many
+	threads before the queue is emptied. Do not let it push out the
+	requests for other pages. */
+	ulint	tail = my_atomic_loadlint(&buf_pool->young_queue_tail);
+
+	if (tail > 0
+	    && ib_uint64_t(my_atomic_load64(reinterpret_cast<int64*>(
+			&buf_pool->young_queue[(tail - 1)
+					       % BUF_YOUNG_QUEUE_SIZE])))
+	    == id) {
+		return;
+	}
+
+	tail = my_atomic_addlint(&buf_pool->young_queue_tail, 1);
+
+	/* If the slot was not empty, the older request in it is lost. */
+	if (!my_atomic_fas64(reinterpret_cast<int64*>(
+				     &buf_pool->young_queue[
+					     tail % BUF_YOUNG_QUEUE_SIZE]),
+			     int64(id))) {
+		my_atomic_addlint(&buf_pool->young_queue_n, 1);
+	}
+}
+
 /********************************************************************//**
 Moves a page to the start of the buffer pool LRU list if it is too old.
 This high-level function can be used to prevent an important page from
@@ -3654,7 +3735,7 @@ buf_page_make_young_if_needed(
 	ut_a(buf_page_in_file(bpage));
 
 	if (buf_page_peek_if_too_old(bpage)) {
-		buf_page_make_young(bpage);
+		buf_page_make_young_deferred(bpage);
 	}
 }
 
@@ -5113,13 +5194,15 @@ Suitable for using when holding the lock_sys_t::mutex.
 @param[in]	file	file name
 @param[in]	line	line where called
 @param[in]	mtr	mini-transaction
+@param[in]	possibly_freed	whether the page may have been freed
 @return pointer to a page or NULL */
 buf_block_t*
 buf_page_try_get_func(
 	const page_id_t&	page_id,
 	const char*		file,
 	unsigned		line,
-	mtr_t*			mtr)
+	mtr_t*			mtr,
+	bool			possibly_freed)
 {
 	buf_block_t*	block;
 	ibool		success;
@@ -5181,7 +5264,7 @@ buf_page_try_get_func(
 #endif /* UNIV_DEBUG || UNIV_BUF_DEBUG */
 
 	ut_d(buf_page_mutex_enter(block));
-	ut_d(ut_a(!block->page.file_page_was_freed));
+	ut_d(ut_a(possibly_freed || !block->page.file_page_was_freed));
 	ut_d(buf_page_mutex_exit(block));
 
 	buf_block_dbg_add_level(block, SYNC_NO_ORDER_CHECK);
@@ -5211,6 +5294,8 @@ buf_page_init_low(
 	bpage->access_time = 0;
 	bpage->newest_modification = 0;
 	bpage->oldest_modification = 0;
+	bpage->write_time = 0;
+	bpage->write_heat = 0;
 	bpage->write_size = 0;
 	bpage->encrypted = false;
 	bpage->real_size = 0;
@@ -109,6 +109,172 @@ buf_dblwr_sync_datafiles()
 	os_aio_wait_until_no_pending_writes();
 }
 
+/** Get the name of the doublewrite file of a buffer pool instance.
+@param[in]	i	buffer pool instance number
+@return own: file name, to be freed with ut_free() */
+static
+char*
+buf_dblwr_file_name(ulint i)
+{
+	char	name[sizeof "ib_doublewrite" + 20];
+
+	snprintf(name, sizeof name, "ib_doublewrite" ULINTPF, i);
+
+	return(fil_make_filepath(*srv_data_home ? srv_data_home : NULL,
+				 name, NO_EXT, false));
+}
+
+/** Free a doublewrite file.
+@param[in,out]	f	doublewrite file */
+static
+void
+buf_dblwr_file_free(buf_dblwr_file_t& f)
+{
+	ut_ad(f.b_reserved == 0);
+
+	os_file_close(f.handle);
+	os_event_destroy(f.b_event);
+	mutex_free(&f.mutex);
+	ut_free(f.write_buf_unaligned);
+	ut_free(f.buf_block_arr);
+	ut_free(f.path);
+}
+
+/** Open or create the doublewrite files that hold the batch flushes of
+each buffer pool instance, if innodb_doublewrite_file_pages is set.
+The files are only written to after buf_dblwr_process() has restored
+any torn pages from their contents.
+@return	srv_buf_pool_instances doublewrite files
+@retval	NULL if the system tablespace is to be used for batch flushes */
+static
+buf_dblwr_file_t*
+buf_dblwr_files_create()
+{
+	if (!srv_doublewrite_file_pages || srv_read_only_mode
+	    || srv_operation != SRV_OPERATION_NORMAL) {
+		return(NULL);
+	}
+
+	const os_offset_t	size = os_offset_t(srv_doublewrite_file_pages)
+		<< srv_page_size_shift;
+	buf_dblwr_file_t*	files = static_cast<buf_dblwr_file_t*>(
+		ut_zalloc_nokey(srv_buf_pool_instances * sizeof *files));
+
+	for (ulint i = 0; i < srv_buf_pool_instances; i++) {
+		buf_dblwr_file_t&	f = files[i];
+		bool			exists;
+		bool			success;
+		os_file_type_t		type;
+
+		f.path = buf_dblwr_file_name(i);
+
+		if (!os_file_status(f.path, &exists, &type)) {
+			success = false;
+		} else {
+			f.handle = os_file_create(
+				innodb_data_file_key, f.path,
+				(exists ? OS_FILE_OPEN : OS_FILE_CREATE)
+				| OS_FILE_ON_ERROR_NO_EXIT,
+				OS_FILE_NORMAL, OS_DATA_FILE, false,
+				&success);
+
+			if (success
+			    && !os_file_set_size(f.path, f.handle, size)) {
+				os_file_close(f.handle);
+				success = false;
+			}
+		}
+
+		if (!success) {
+			ib::error() << "Cannot create the doublewrite file "
+				<< f.path << "; using the doublewrite buffer"
+				" in the system tablespace for all writes";
+			ut_free(f.path);
+
+			while (i--) {
+				buf_dblwr_file_free(files[i]);
+			}
+
+			ut_free(files);
+			return(NULL);
+		}
+
+		mutex_create(LATCH_ID_BUF_DBLWR, &f.mutex);
+		f.b_event = os_event_create("dblwr_file_batch_event");
+
+		f.write_buf_unaligned = static_cast<byte*>(
+			ut_malloc_nokey((1 + srv_doublewrite_file_pages)
+					<< srv_page_size_shift));
+		f.write_buf = static_cast<byte*>(
+			ut_align(f.write_buf_unaligned, UNIV_PAGE_SIZE));
+		f.buf_block_arr = static_cast<buf_page_t**>(
+			ut_zalloc_nokey(srv_doublewrite_file_pages
+					* sizeof(void*)));
+	}
+
+	return(files);
+}
+
+/** Read the pages of any doublewrite files for crash recovery.
+Files of buffer pool instances that are no longer configured are read
+as well, because they may hold the only good copy of a page. */
+static
+void
+buf_dblwr_files_load()
+{
+	recv_dblwr_t&	recv_dblwr = recv_sys->dblwr;
+
+	for (ulint i = 0; i < MAX_BUFFER_POOLS; i++) {
+		char*		path = buf_dblwr_file_name(i);
+		bool		success;
+		pfs_os_file_t	file = os_file_create_simple_no_error_handling(
+			innodb_data_file_key, path, OS_FILE_OPEN,
+			OS_FILE_READ_ONLY, true, &success);
+
+		if (!success) {
+			ut_free(path);
+			continue;
+		}
+
+		const os_offset_t	size = os_file_get_size(file);
+		ulint			n_pages = size == os_offset_t(-1)
+			? 0 : ulint(size >> srv_page_size_shift);
+
+		if (n_pages) {
+			byte*	unaligned_buf = static_cast<byte*>(
+				ut_malloc_nokey((1 + n_pages)
+						<< srv_page_size_shift));
+			byte*	page = static_cast<byte*>(
+				ut_align(unaligned_buf, UNIV_PAGE_SIZE));
+
+			IORequest	read_request(IORequest::READ);
+
+			if (os_file_read(read_request, file, page, 0,
+					 n_pages << srv_page_size_shift)
+			    != DB_SUCCESS) {
+				ib::warn() << "Ignoring the unreadable"
+					" doublewrite file " << path;
+				ut_free(unaligned_buf);
+				n_pages = 0;
+			} else {
+				recv_dblwr.add_buf(unaligned_buf);
+			}
+
+			for (; n_pages--; page += srv_page_size) {
+				/* Each valid page header must contain
+				a nonzero FIL_PAGE_LSN field. */
+				if (memcmp(field_ref_zero,
+					   page + FIL_PAGE_LSN, 8)) {
+					recv_dblwr.add(page);
+				}
+			}
+		}
+
+		os_file_close(file);
+		ut_free(path);
+	}
+}
+
 /****************************************************************//**
 Creates or initialializes the doublewrite buffer at a database start. */
 static
@@ -157,6 +323,8 @@ buf_dblwr_init(
 
 	buf_dblwr->buf_block_arr = static_cast<buf_page_t**>(
 		ut_zalloc_nokey(buf_size * sizeof(void*)));
+
+	buf_dblwr->files = buf_dblwr_files_create();
 }
 
 /** Create the doublewrite buffer if the doublewrite buffer header
@@ -512,6 +680,8 @@ buf_dblwr_init_or_load_pages(
 
 	ut_free(unaligned_read_buf);
 
+	buf_dblwr_files_load();
+
 	return(DB_SUCCESS);
 }
 
@@ -552,6 +722,12 @@ buf_dblwr_process()
 		const ulint		page_no	= page_get_page_no(page);
 		const page_id_t		page_id(space_id, page_no);
 
+		if (page != recv_dblwr.find_page(space_id, page_no)) {
+			/* The doublewrite files can hold several
+			copies of a page. Only restore the newest one. */
+			continue;
+		}
+
 		if (page_no >= space->size) {
 
 			/* Do not report the warning if the tablespace
@@ -677,7 +853,7 @@ buf_dblwr_process()
 			<< " from the doublewrite buffer.";
 	}
 
-	recv_dblwr.pages.clear();
+	recv_dblwr.clear();
 
 	fil_flush_file_spaces(FIL_TYPE_TABLESPACE);
 	ut_free(unaligned_read_buf);
@@ -704,11 +880,52 @@ buf_dblwr_free()
 	ut_free(buf_dblwr->in_use);
 	buf_dblwr->in_use = NULL;
 
+	if (buf_dblwr_file_t* files = buf_dblwr->files) {
+		for (ulint i = 0; i < srv_buf_pool_instances; i++) {
+			buf_dblwr_file_free(files[i]);
+		}
+
+		ut_free(files);
+		buf_dblwr->files = NULL;
+	}
+
 	mutex_free(&buf_dblwr->mutex);
 	ut_free(buf_dblwr);
 	buf_dblwr = NULL;
 }
 
+/** Note that a page write of a batch flush completed.
+@tparam	dblwr		buf_dblwr_t or buf_dblwr_file_t
+@param[in,out]	d	the doublewrite area that holds the batch */
+template<class dblwr>
+static
+void
+buf_dblwr_batch_update(dblwr& d)
+{
+	mutex_enter(&d.mutex);
+
+	ut_ad(d.batch_running);
+	ut_ad(d.b_reserved > 0);
+	ut_ad(d.b_reserved <= d.first_free);
+
+	d.b_reserved--;
+
+	if (d.b_reserved == 0) {
+		mutex_exit(&d.mutex);
+		/* This will finish the batch. Sync data files
+		to the disk. */
+		fil_flush_file_spaces(FIL_TYPE_TABLESPACE);
+		mutex_enter(&d.mutex);
+
+		/* We can now reuse the doublewrite memory buffer: */
+		d.first_free = 0;
+		d.batch_running = false;
+		os_event_set(d.b_event);
+	}
+
+	mutex_exit(&d.mutex);
+}
+
 /********************************************************************//**
 Updates the doublewrite buffer when an IO request is completed. */
 void
@@ -725,28 +942,12 @@ buf_dblwr_update(
 	switch (flush_type) {
 	case BUF_FLUSH_LIST:
 	case BUF_FLUSH_LRU:
-		mutex_enter(&buf_dblwr->mutex);
-
-		ut_ad(buf_dblwr->batch_running);
-		ut_ad(buf_dblwr->b_reserved > 0);
-		ut_ad(buf_dblwr->b_reserved <= buf_dblwr->first_free);
-
-		buf_dblwr->b_reserved--;
-
-		if (buf_dblwr->b_reserved == 0) {
-			mutex_exit(&buf_dblwr->mutex);
-			/* This will finish the batch. Sync data files
-			to the disk. */
-			fil_flush_file_spaces(FIL_TYPE_TABLESPACE);
-			mutex_enter(&buf_dblwr->mutex);
-
-			/* We can now reuse the doublewrite memory buffer: */
-			buf_dblwr->first_free = 0;
-			buf_dblwr->batch_running = false;
-			os_event_set(buf_dblwr->b_event);
+		if (buf_dblwr->files) {
+			buf_dblwr_batch_update(
+				buf_dblwr->files[bpage->buf_pool_index]);
+		} else {
+			buf_dblwr_batch_update(*buf_dblwr);
 		}
-
-		mutex_exit(&buf_dblwr->mutex);
 		break;
 	case BUF_FLUSH_SINGLE_PAGE:
 		{
@@ -889,14 +1090,18 @@ void
 buf_dblwr_write_block_to_datafile(
 /*==============================*/
 	const buf_page_t*	bpage,	/*!< in: page to write */
-	bool			sync)	/*!< in: true if sync IO
+	bool			sync,	/*!< in: true if sync IO
 					is requested */
+	bool			wake)	/*!< in: false if the caller
+					will invoke
+					os_aio_simulated_wake_handler_threads()
+					after posting a batch of writes */
 {
 	ut_a(buf_page_in_file(bpage));
 
 	ulint	type = IORequest::WRITE;
 
-	if (sync) {
+	if (sync || !wake) {
 		type |= IORequest::DO_NOT_WAKE;
 	}
 
@@ -931,39 +1136,99 @@ buf_dblwr_write_block_to_datafile(
 	}
 }
 
-/********************************************************************//**
-Flushes possible buffered writes from the doublewrite memory buffer to disk,
-and also wakes up the aio thread if simulated aio is used. It is very
-important to call this function after a batch of writes has been posted,
-and also when we may have to wait for a page latch! Otherwise a deadlock
-of threads can occur. */
+/** @return the number of batch flush pages in the system tablespace */
+static
+ulint
+buf_dblwr_batch_size(const buf_dblwr_t&)
+{
+	return(srv_doublewrite_batch_size);
+}
+
+/** @return the number of batch flush pages in a doublewrite file */
+static
+ulint
+buf_dblwr_batch_size(const buf_dblwr_file_t&)
+{
+	return(srv_doublewrite_file_pages);
+}
+
+/** Write a batch to the doublewrite buffer in the system tablespace,
+and flush it to disk.
+@param[in]	d		doublewrite buffer
+@param[in]	first_free	number of pages in the batch */
+static
 void
-buf_dblwr_flush_buffered_writes()
+buf_dblwr_batch_write(const buf_dblwr_t& d, ulint first_free)
 {
-	byte*		write_buf;
-	ulint		first_free;
-	ulint		len;
+	ulint	len;
+	byte*	write_buf = d.write_buf;
 
-	if (!srv_use_doublewrite_buf || buf_dblwr == NULL) {
-		/* Sync the writes to the disk. */
-		buf_dblwr_sync_datafiles();
-		/* Now we flush the data to disk (for example, with fsync) */
-		fil_flush_file_spaces(FIL_TYPE_TABLESPACE);
-		return;
+	/* Write out the first block of the doublewrite buffer */
+	len = ut_min(TRX_SYS_DOUBLEWRITE_BLOCK_SIZE,
+		     first_free) * UNIV_PAGE_SIZE;
+
+	fil_io(IORequestWrite, true,
+	       page_id_t(TRX_SYS_SPACE, d.block1), univ_page_size,
+	       0, len, (void*) write_buf, NULL);
+
+	if (first_free > TRX_SYS_DOUBLEWRITE_BLOCK_SIZE) {
+		/* Write out the second block of the doublewrite buffer. */
+		len = (first_free - TRX_SYS_DOUBLEWRITE_BLOCK_SIZE)
+			* UNIV_PAGE_SIZE;
+
+		write_buf += TRX_SYS_DOUBLEWRITE_BLOCK_SIZE * UNIV_PAGE_SIZE;
+
+		fil_io(IORequestWrite, true,
+		       page_id_t(TRX_SYS_SPACE, d.block2), univ_page_size,
+		       0, len, (void*) write_buf, NULL);
 	}
 
-	ut_ad(!srv_read_only_mode);
+	/* Now flush the doublewrite buffer data to disk */
+	fil_flush(TRX_SYS_SPACE);
+}
+
+/** Write a batch to a doublewrite file, and flush it to disk.
+Unlike the system tablespace, the file is not shared with other
+buffer pool instances, and nothing else needs to be flushed.
+@param[in]	f		doublewrite file
+@param[in]	first_free	number of pages in the batch */
+static
+void
+buf_dblwr_batch_write(const buf_dblwr_file_t& f, ulint first_free)
+{
+	IORequest	request(IORequest::WRITE);
+
+	dberr_t	err = os_file_write(request, f.path, f.handle, f.write_buf,
+				    0, first_free << srv_page_size_shift);
+
+	if (err != DB_SUCCESS || !os_file_flush(f.handle)) {
+		ib::fatal() << "Cannot write to the doublewrite file "
+			<< f.path;
+	}
+}
+
+/** Write the pages of a batch flush first to a doublewrite area and
+then to the data files.
+@tparam	dblwr		buf_dblwr_t or buf_dblwr_file_t
+@param[in,out]	d	the doublewrite area that holds the batch */
+template<class dblwr>
+static
+void
+buf_dblwr_batch_flush(dblwr& d)
+{
+	byte*		write_buf;
+	ulint		first_free;
 
 try_again:
-	mutex_enter(&buf_dblwr->mutex);
+	mutex_enter(&d.mutex);
 
 	/* Write first to doublewrite buffer blocks. We use synchronous
 	aio and thus know that file write has been completed when the
 	control returns. */
 
-	if (buf_dblwr->first_free == 0) {
+	if (d.first_free == 0) {
 
-		mutex_exit(&buf_dblwr->mutex);
+		mutex_exit(&d.mutex);
 
 		/* Wake possible simulated aio thread as there could be
 		system temporary tablespace pages active for flushing.
@@ -974,38 +1239,38 @@ buf_dblwr_flush_buffered_writes()
 		return;
 	}
 
-	if (buf_dblwr->batch_running) {
+	if (d.batch_running) {
 		/* Another thread is running the batch right now. Wait
 		for it to finish. */
-		int64_t	sig_count = os_event_reset(buf_dblwr->b_event);
-		mutex_exit(&buf_dblwr->mutex);
+		int64_t	sig_count = os_event_reset(d.b_event);
+		mutex_exit(&d.mutex);
 
-		os_event_wait_low(buf_dblwr->b_event, sig_count);
+		os_event_wait_low(d.b_event, sig_count);
 		goto try_again;
 	}
 
-	ut_ad(buf_dblwr->first_free == buf_dblwr->b_reserved);
+	ut_ad(d.first_free == d.b_reserved);
 
 	/* Disallow anyone else to post to doublewrite buffer or to
 	start another batch of flushing. */
-	buf_dblwr->batch_running = true;
-	first_free = buf_dblwr->first_free;
+	d.batch_running = true;
+	first_free = d.first_free;
 
 	/* Now safe to release the mutex. Note that though no other
 	thread is allowed to post to the doublewrite batch flushing
 	but any threads working on single page flushes are allowed
 	to proceed. */
-	mutex_exit(&buf_dblwr->mutex);
+	mutex_exit(&d.mutex);
 
-	write_buf = buf_dblwr->write_buf;
+	write_buf = d.write_buf;
 
 	for (ulint len2 = 0, i = 0;
-	     i < buf_dblwr->first_free;
+	     i < first_free;
 	     len2 += UNIV_PAGE_SIZE, i++) {
 
 		const buf_block_t*	block;
 
-		block = (buf_block_t*) buf_dblwr->buf_block_arr[i];
+		block = (buf_block_t*) d.buf_block_arr[i];
 
 		if (buf_block_get_state(block) != BUF_BLOCK_FILE_PAGE
 		    || block->page.zip.data) {
@@ -1023,57 +1288,31 @@ buf_dblwr_flush_buffered_writes()
 		buf_dblwr_check_page_lsn(write_buf + len2);
 	}
 
-	/* Write out the first block of the doublewrite buffer */
-	len = ut_min(TRX_SYS_DOUBLEWRITE_BLOCK_SIZE,
-		     buf_dblwr->first_free) * UNIV_PAGE_SIZE;
-
-	fil_io(IORequestWrite, true,
-	       page_id_t(TRX_SYS_SPACE, buf_dblwr->block1), univ_page_size,
-	       0, len, (void*) write_buf, NULL);
-
-	if (buf_dblwr->first_free <= TRX_SYS_DOUBLEWRITE_BLOCK_SIZE) {
-		/* No unwritten pages in the second block. */
-		goto flush;
-	}
-
-	/* Write out the second block of the doublewrite buffer. */
-	len = (buf_dblwr->first_free - TRX_SYS_DOUBLEWRITE_BLOCK_SIZE)
-	       * UNIV_PAGE_SIZE;
-
-	write_buf = buf_dblwr->write_buf
-		    + TRX_SYS_DOUBLEWRITE_BLOCK_SIZE * UNIV_PAGE_SIZE;
-
-	fil_io(IORequestWrite, true,
-	       page_id_t(TRX_SYS_SPACE, buf_dblwr->block2), univ_page_size,
-	       0, len, (void*) write_buf, NULL);
+	buf_dblwr_batch_write(d, first_free);
 
-flush:
 	/* increment the doublewrite flushed pages counter */
-	srv_stats.dblwr_pages_written.add(buf_dblwr->first_free);
+	srv_stats.dblwr_pages_written.add(first_free);
 	srv_stats.dblwr_writes.inc();
 
-	/* Now flush the doublewrite buffer data to disk */
-	fil_flush(TRX_SYS_SPACE);
-
 	/* We know that the writes have been flushed to disk now
 	and in recovery we will find them in the doublewrite buffer
 	blocks. Next do the writes to the intended positions. */
 
-	/* Up to this point first_free and buf_dblwr->first_free are
-	same because we have set the buf_dblwr->batch_running flag
+	/* Up to this point first_free and d.first_free are
+	same because we have set the d.batch_running flag
 	disallowing any other thread to post any request but we
-	can't safely access buf_dblwr->first_free in the loop below.
+	can't safely access d.first_free in the loop below.
 	This is so because it is possible that after we are done with
 	the last iteration and before we terminate the loop, the batch
 	gets finished in the IO helper thread and another thread posts
-	a new batch setting buf_dblwr->first_free to a higher value.
-	If this happens and we are using buf_dblwr->first_free in the
+	a new batch setting d.first_free to a higher value.
+	If this happens and we are using d.first_free in the
 	loop termination condition then we'll end up dispatching
 	the same block twice from two different threads. */
-	ut_ad(first_free == buf_dblwr->first_free);
+	ut_ad(first_free == d.first_free);
 	for (ulint i = 0; i < first_free; i++) {
 		buf_dblwr_write_block_to_datafile(
-			buf_dblwr->buf_block_arr[i], false);
+			d.buf_block_arr[i], false, false);
 	}
 
 	/* Wake possible simulated aio thread to actually post the
@@ -1083,23 +1322,49 @@ buf_dblwr_flush_buffered_writes()
 	os_aio_simulated_wake_handler_threads();
 }
 
-/********************************************************************//**
-Posts a buffer page for writing. If the doublewrite memory buffer is
-full, calls buf_dblwr_flush_buffered_writes and waits for for free
-space to appear. */
+/** Flushes possible buffered writes from the doublewrite memory buffer to disk,
+and also wakes up the aio thread if simulated aio is used. It is very
+important to call this function after a batch of writes has been posted,
+and also when we may have to wait for a page latch! Otherwise a deadlock
+of threads can occur.
+@param[in]	buf_pool	buffer pool instance whose batch to write */
 void
-buf_dblwr_add_to_batch(
-/*====================*/
-	buf_page_t*	bpage)	/*!< in: buffer block to write */
+buf_dblwr_flush_buffered_writes(const buf_pool_t* buf_pool)
 {
-	ut_a(buf_page_in_file(bpage));
+	if (!srv_use_doublewrite_buf || buf_dblwr == NULL) {
+		/* Sync the writes to the disk. */
+		buf_dblwr_sync_datafiles();
+		/* Now we flush the data to disk (for example, with fsync) */
+		fil_flush_file_spaces(FIL_TYPE_TABLESPACE);
+		return;
+	}
+
+	ut_ad(!srv_read_only_mode);
+
+	if (buf_dblwr->files) {
+		buf_dblwr_batch_flush(buf_dblwr->files[buf_pool->instance_no]);
+	} else {
+		buf_dblwr_batch_flush(*buf_dblwr);
+	}
+}
+
+/** Post a buffer page for writing to a doublewrite area.
+@tparam	dblwr		buf_dblwr_t or buf_dblwr_file_t
+@param[in,out]	d	the doublewrite area of the buffer pool instance
+@param[in]	bpage	buffer block to write */
+template<class dblwr>
+static
+void
+buf_dblwr_batch_add(dblwr& d, buf_page_t* bpage)
+{
+	const ulint	batch_size = buf_dblwr_batch_size(d);
 
 try_again:
-	mutex_enter(&buf_dblwr->mutex);
+	mutex_enter(&d.mutex);
 
-	ut_a(buf_dblwr->first_free <= srv_doublewrite_batch_size);
+	ut_a(d.first_free <= batch_size);
 
-	if (buf_dblwr->batch_running) {
+	if (d.batch_running) {
 
 		/* This not nearly as bad as it looks. There is only
 		page_cleaner thread which does background flushing
@@ -1107,23 +1372,23 @@ buf_dblwr_add_to_batch(
 		point. The only exception is when a user thread is
 		forced to do a flush batch because of a sync
 		checkpoint. */
-		int64_t	sig_count = os_event_reset(buf_dblwr->b_event);
-		mutex_exit(&buf_dblwr->mutex);
+		int64_t	sig_count = os_event_reset(d.b_event);
+		mutex_exit(&d.mutex);
 
-		os_event_wait_low(buf_dblwr->b_event, sig_count);
+		os_event_wait_low(d.b_event, sig_count);
 		goto try_again;
 	}
 
-	if (buf_dblwr->first_free == srv_doublewrite_batch_size) {
-		mutex_exit(&(buf_dblwr->mutex));
+	if (d.first_free == batch_size) {
+		mutex_exit(&d.mutex);
 
-		buf_dblwr_flush_buffered_writes();
+		buf_dblwr_batch_flush(d);
 
 		goto try_again;
 	}
 
-	byte*	p = buf_dblwr->write_buf
-		+ univ_page_size.physical() * buf_dblwr->first_free;
+	byte*	p = d.write_buf
+		+ univ_page_size.physical() * d.first_free;
 
 	/* We request frame here to get correct buffer in case of
 	encryption and/or page compression */
@@ -1146,24 +1411,43 @@ buf_dblwr_add_to_batch(
 		memcpy(p, frame, bpage->size.logical());
 	}
 
-	buf_dblwr->buf_block_arr[buf_dblwr->first_free] = bpage;
+	d.buf_block_arr[d.first_free] = bpage;
 
-	buf_dblwr->first_free++;
-	buf_dblwr->b_reserved++;
+	d.first_free++;
+	d.b_reserved++;
 
-	ut_ad(!buf_dblwr->batch_running);
-	ut_ad(buf_dblwr->first_free == buf_dblwr->b_reserved);
-	ut_ad(buf_dblwr->b_reserved <= srv_doublewrite_batch_size);
+	ut_ad(!d.batch_running);
+	ut_ad(d.first_free == d.b_reserved);
+	ut_ad(d.b_reserved <= batch_size);
 
-	if (buf_dblwr->first_free == srv_doublewrite_batch_size) {
-		mutex_exit(&(buf_dblwr->mutex));
+	if (d.first_free == batch_size) {
+		mutex_exit(&d.mutex);
 
-		buf_dblwr_flush_buffered_writes();
+		buf_dblwr_batch_flush(d);
 
 		return;
 	}
 
-	mutex_exit(&(buf_dblwr->mutex));
+	mutex_exit(&d.mutex);
+}
+
+/********************************************************************//**
+Posts a buffer page for writing. If the doublewrite memory buffer is
+full, calls buf_dblwr_flush_buffered_writes and waits for for free
+space to appear. */
+void
+buf_dblwr_add_to_batch(
+/*====================*/
+	buf_page_t*	bpage)	/*!< in: buffer block to write */
+{
+	ut_a(buf_page_in_file(bpage));
+
+	if (buf_dblwr->files) {
+		buf_dblwr_batch_add(buf_dblwr->files[bpage->buf_pool_index],
+				    bpage);
+	} else {
+		buf_dblwr_batch_add(*buf_dblwr, bpage);
+	}
 }
 
 /********************************************************************//**
@@ -1300,5 +1584,5 @@ buf_dblwr_write_single_page(
 	/* We know that the write has been flushed to disk now
 	and during recovery we will find it in the doublewrite buffer
 	blocks. Next do the write to the intended position. */
-	buf_dblwr_write_block_to_datafile(bpage, sync);
+	buf_dblwr_write_block_to_datafile(bpage, sync, true);
 }
@@ -84,6 +84,21 @@ static lsn_t lsn_avg_rate = 0;
 /** Target oldest LSN for the requested flush_sync */
 static lsn_t buf_flush_sync_lsn = 0;
 
+/** Target oldest LSN for the adaptive flushing, requested by
+log_checkpointer_thread; protected by page_cleaner_t::mutex */
+static lsn_t buf_flush_pace_lsn = 0;
+
+/** Hot pages whose oldest modification is newer than this may be left
+for a later batch; LSN_MAX outside the adaptive flushing batches of the
+page cleaner */
+static lsn_t buf_flush_hot_lsn = LSN_MAX;
+
+/** buf_page_t::write_heat at which a page is considered hot */
+static const byte BUF_FLUSH_HOT_HEAT = 2;
+
+/** Maximum value of buf_page_t::write_heat */
+static const byte BUF_FLUSH_MAX_HEAT = 16;
+
 #ifdef UNIV_PFS_THREAD
 mysql_pfs_key_t page_cleaner_thread_key;
 #endif /* UNIV_PFS_THREAD */
@@ -119,6 +134,9 @@ struct page_cleaner_slot_t {
 	ulint			n_pages_requested;
 					/*!< number of requested pages
 					for the slot */
+	ulint			n_pages_for_pace;
+					/*!< number of pages that must be
+					flushed to reach buf_flush_pace_lsn */
 	/* These values are updated during state==PAGE_CLEANER_STATE_FLUSHING,
 	and commited with state==PAGE_CLEANER_STATE_FINISHED.
 	The consistency is protected by the 'state' */
@@ -415,6 +433,31 @@ buf_flush_free_flush_rbt(void)
 	}
 }
 
+/** Update the write heat of a page that is being modified for the first
+time after it was written to the data file.
+@param[in,out]	bpage	page that is being added to the flush list */
+static
+void
+buf_flush_note_rewrite(buf_page_t* bpage)
+{
+	if (!bpage->write_time || !srv_flush_hot_page_interval) {
+		return;
+	}
+
+	if (static_cast<unsigned>(ut_time_ms()) - bpage->write_time
+	    < srv_flush_hot_page_interval) {
+		/* The write would not have been needed, had it been
+		done after this modification. */
+		MONITOR_INC(MONITOR_FLUSH_WASTED_WRITES);
+
+		if (bpage->write_heat < BUF_FLUSH_MAX_HEAT) {
+			bpage->write_heat++;
+		}
+	} else {
+		bpage->write_heat >>= 1;
+	}
+}
+
 /********************************************************************//**
 Inserts a modified block into the flush list. */
 void
@@ -447,6 +490,7 @@ buf_flush_insert_into_flush_list(
 
 	ut_d(block->page.in_flush_list = TRUE);
 	block->page.oldest_modification = lsn;
+	buf_flush_note_rewrite(&block->page);
 
 	UT_LIST_ADD_FIRST(buf_pool->flush_list, &block->page);
 
@@ -512,6 +556,7 @@ buf_flush_insert_sorted_into_flush_list(
 	ut_ad(!block->page.in_flush_list);
 	ut_d(block->page.in_flush_list = TRUE);
 	block->page.oldest_modification = lsn;
+	buf_flush_note_rewrite(&block->page);
 
 #ifdef UNIV_DEBUG_VALGRIND
 	void*	p;
@@ -802,6 +847,10 @@ void buf_flush_write_complete(buf_page_t* bpage, bool dblwr)
 
 	buf_flush_remove(bpage);
 
+	if (srv_flush_hot_page_interval) {
+		bpage->write_time = static_cast<unsigned>(ut_time_ms());
+	}
+
 	flush_type = buf_page_get_flush_type(bpage);
 	buf_pool->n_flush[flush_type]--;
 	ut_ad(buf_pool->n_flush[flush_type] != ULINT_MAX);
@@ -1231,7 +1280,7 @@ buf_flush_page(
 				/* avoiding deadlock possibility involves
 				doublewrite buffer, should flush it, because
 				it might hold the another block->lock. */
-				buf_dblwr_flush_buffered_writes();
+				buf_dblwr_flush_buffered_writes(buf_pool);
 			} else {
 				buf_dblwr_sync_datafiles();
 			}
@@ -1654,6 +1703,7 @@ buf_flush_LRU_list_batch(
 	n->evicted = 0;
 	n->unzip_LRU_evicted = 0;
 	ut_ad(buf_pool_mutex_own(buf_pool));
+	buf_LRU_make_queued_young(buf_pool);
 	if (buf_pool->curr_size < buf_pool->old_size
 	    && buf_pool->withdraw_target > 0) {
 		withdraw_depth = buf_pool->withdraw_target
@@ -1779,6 +1829,11 @@ buf_do_flush_list_batch(
 {
 	ulint		count = 0;
 	ulint		scanned = 0;
+	ulint		deferred = 0;
+	/* Only the adaptive flushing of the page cleaner may skip
+	hot pages; other batches must reach their target. */
+	const lsn_t	hot_lsn = lsn_limit == LSN_MAX && min_n != ULINT_MAX
+		? buf_flush_hot_lsn : LSN_MAX;
 
 	ut_ad(buf_pool_mutex_own(buf_pool));
 
@@ -1805,6 +1860,18 @@ buf_do_flush_list_batch(
 
 		prev = UT_LIST_GET_PREV(list, bpage);
 		buf_pool->flush_hp.set(prev);
+
+		if (bpage->oldest_modification > hot_lsn
+		    && bpage->write_heat >= BUF_FLUSH_HOT_HEAT
+		    && deferred < min_n) {
+			/* The page is likely to be modified again soon.
+			Flush colder pages instead, until the redo log
+			age of this one makes it due. */
+			++deferred;
+			--len;
+			continue;
+		}
+
 		buf_flush_list_mutex_exit(buf_pool);
 
 #ifdef UNIV_DEBUG
@@ -1823,6 +1890,10 @@ buf_do_flush_list_batch(
 	buf_pool->flush_hp.set(NULL);
 	buf_flush_list_mutex_exit(buf_pool);
 
+	if (deferred) {
+		MONITOR_INC_VALUE(MONITOR_FLUSH_HOT_DEFERRED, deferred);
+	}
+
 	if (scanned) {
 		MONITOR_INC_VALUE_CUMULATIVE(
 			MONITOR_FLUSH_BATCH_SCANNED,
@@ -1972,7 +2043,7 @@ buf_flush_end(
 	buf_pool_mutex_exit(buf_pool);
 
 	if (!srv_read_only_mode) {
-		buf_dblwr_flush_buffered_writes();
+		buf_dblwr_flush_buffered_writes(buf_pool);
 	} else {
 		os_aio_simulated_wake_handler_threads();
 	}
@@ -2580,31 +2651,45 @@ page_cleaner_flush_pages_recommendation(
 
 	/* Estimate pages to be flushed for the lsn progress */
 	ulint	sum_pages_for_lsn = 0;
+	ulint	sum_pages_for_pace = 0;
 	lsn_t	target_lsn = oldest_lsn
 			     + lsn_avg_rate * buf_flush_lsn_scan_factor;
 
+	mutex_enter(&page_cleaner.mutex);
+	const lsn_t	pace_lsn = buf_flush_pace_lsn;
+	mutex_exit(&page_cleaner.mutex);
+
 	for (ulint i = 0; i < srv_buf_pool_instances; i++) {
 		buf_pool_t*	buf_pool = buf_pool_from_array(i);
 		ulint		pages_for_lsn = 0;
+		ulint		pages_for_pace = 0;
 
 		buf_flush_list_mutex_enter(buf_pool);
 		for (buf_page_t* b = UT_LIST_GET_LAST(buf_pool->flush_list);
 		     b != NULL;
 		     b = UT_LIST_GET_PREV(list, b)) {
-			if (b->oldest_modification > target_lsn) {
+			const lsn_t	lsn = b->oldest_modification;
+
+			if (lsn > target_lsn
+			    && (lsn > pace_lsn
+				|| pages_for_pace >= srv_max_io_capacity)) {
 				break;
 			}
-			++pages_for_lsn;
+
+			pages_for_lsn += lsn <= target_lsn;
+			pages_for_pace += lsn <= pace_lsn;
 		}
 		buf_flush_list_mutex_exit(buf_pool);
 
 		sum_pages_for_lsn += pages_for_lsn;
+		sum_pages_for_pace += pages_for_pace;
 
 		mutex_enter(&page_cleaner.mutex);
 		ut_ad(page_cleaner.slots[i].state
 		      == PAGE_CLEANER_STATE_NONE);
 		page_cleaner.slots[i].n_pages_requested
 			= pages_for_lsn / buf_flush_lsn_scan_factor + 1;
+		page_cleaner.slots[i].n_pages_for_pace = pages_for_pace;
 		mutex_exit(&page_cleaner.mutex);
 	}
 
@@ -2620,6 +2705,12 @@ page_cleaner_flush_pages_recommendation(
 
 	n_pages = (PCT_IO(pct_total) + avg_page_rate + pages_for_lsn) / 3;
 
+	/* Flush at least as much as log_checkpointer_thread asked for,
+	so that log_free_check() will not have to wait for flushing. */
+	if (n_pages < sum_pages_for_pace) {
+		n_pages = sum_pages_for_pace;
+	}
+
 	if (n_pages > srv_max_io_capacity) {
 		n_pages = srv_max_io_capacity;
 	}
@@ -2630,6 +2721,17 @@ page_cleaner_flush_pages_recommendation(
 	ut_ad(page_cleaner.n_slots_flushing == 0);
 	ut_ad(page_cleaner.n_slots_finished == 0);
 
+	/* Hot pages may be deferred while they are in the younger half
+	of max_modified_age_async and not needed for the progress that
+	log_checkpointer_thread asked for. */
+	if (srv_flush_hot_page_interval) {
+		const lsn_t	hot_age = log_get_max_modified_age_async() / 2;
+
+		buf_flush_hot_lsn = std::max(
+			cur_lsn > hot_age ? cur_lsn - hot_age : 0,
+			pace_lsn);
+	}
+
 	for (ulint i = 0; i < srv_buf_pool_instances; i++) {
 		/* if REDO has enough of free space,
 		don't care about age distribution of pages */
@@ -2637,6 +2739,11 @@ page_cleaner_flush_pages_recommendation(
 			page_cleaner.slots[i].n_pages_requested
 			* n_pages / sum_pages_for_lsn + 1
 			: n_pages / srv_buf_pool_instances;
+
+		page_cleaner.slots[i].n_pages_requested = std::max<ulint>(
+			page_cleaner.slots[i].n_pages_requested,
+			std::min<ulint>(page_cleaner.slots[i].n_pages_for_pace,
+					srv_max_io_capacity));
 	}
 	mutex_exit(&page_cleaner.mutex);
 
@@ -3273,6 +3380,9 @@ DECLARE_THREAD(buf_flush_page_cleaner_coordinator)(void*)
 
 			pc_wait_finished(&n_flushed_lru, &n_flushed_list);
 
+			/* Other batches must not skip hot pages. */
+			buf_flush_hot_lsn = LSN_MAX;
+
 			if (n_flushed_list > 0 || n_flushed_lru > 0) {
 				buf_flush_stats(n_flushed_list, n_flushed_lru);
 			}
@@ -3578,6 +3688,19 @@ buf_flush_request_force(
 
 	os_event_set(buf_flush_event);
 }
+
+/** Set the oldest modification LSN that the adaptive flushing of the
+page cleaner should reach in its next round.
+@param[in]	lsn	target for buf_pool_get_oldest_modification(),
+or 0 if the page cleaner may decide on its own */
+void
+buf_flush_set_pace_lsn(
+	lsn_t	lsn)
+{
+	mutex_enter(&page_cleaner.mutex);
+	buf_flush_pace_lsn = lsn;
+	mutex_exit(&page_cleaner.mutex);
+}
 #if defined UNIV_DEBUG || defined UNIV_BUF_DEBUG
 
 /** Functor to validate the flush list. */
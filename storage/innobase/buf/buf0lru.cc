@@ -127,6 +127,10 @@ least this many milliseconds ago.  Not protected by any mutex or latch. */
 uint	buf_LRU_old_threshold_ms;
 /* @} */
 
+/** innodb_unzip_lru_policy; enum buf_LRU_unzip_policy_t.
+Not protected by any mutex. */
+ulong	buf_LRU_unzip_policy;
+
 /******************************************************************//**
 Takes a block out of the LRU list and page hash table.
 If the block is compressed-only (BUF_BLOCK_ZIP_PAGE),
@@ -191,6 +195,15 @@ buf_LRU_evict_from_unzip_LRU(
 		return(FALSE);
 	}
 
+	switch (buf_LRU_unzip_policy) {
+	case BUF_LRU_UNZIP_KEEP_COMPRESSED:
+		/* Keep as many compressed pages as possible in the
+		buffer pool, at the cost of more page_zip_decompress(). */
+		return(TRUE);
+	case BUF_LRU_UNZIP_KEEP_UNCOMPRESSED:
+		return(FALSE);
+	}
+
 	/* If unzip_LRU is at most 10% of the size of the LRU list,
 	then use the LRU.  This slack allows us to keep hot
 	decompressed pages in the buffer pool. */
@@ -878,6 +891,8 @@ buf_LRU_scan_and_free_block(
 {
 	ut_ad(buf_pool_mutex_own(buf_pool));
 
+	buf_LRU_make_queued_young(buf_pool);
+
 	return(buf_LRU_free_from_unzip_LRU_list(buf_pool, scan_all)
 	       || buf_LRU_free_from_common_LRU_list(buf_pool, scan_all));
 }
@@ -1544,6 +1559,57 @@ buf_LRU_make_block_young(
 	buf_LRU_add_block_low(bpage, FALSE);
 }
 
+/** Move the pages requested by buf_page_make_young_deferred() to the
+start of the LRU list, if they are still in the buffer pool and old
+enough to be made young.
+@param[in,out]	buf_pool	buffer pool instance */
+void
+buf_LRU_make_queued_young(buf_pool_t* buf_pool)
+{
+	ut_ad(buf_pool_mutex_own(buf_pool));
+
+	/* This is invoked on every LRU scan, and the queue is usually
+	empty. A request that was written but not yet counted will be
+	found by a later call. */
+	ulint	n = my_atomic_loadlint(&buf_pool->young_queue_n);
+
+	for (ulint i = 0; n > 0 && i < BUF_YOUNG_QUEUE_SIZE; i++) {
+		const ib_uint64_t id = ib_uint64_t(my_atomic_fas64(
+			reinterpret_cast<int64*>(&buf_pool->young_queue[i]),
+			0));
+
+		if (id == 0) {
+			continue;
+		}
+
+		my_atomic_addlint(&buf_pool->young_queue_n, ulint(-1));
+		n--;
+
+		const page_id_t	page_id(ulint((id - 1) >> 32),
+					ulint((id - 1) & 0xFFFFFFFFU));
+		rw_lock_t*	hash_lock = buf_page_hash_lock_get(
+			buf_pool, page_id);
+
+		rw_lock_s_lock(hash_lock);
+
+		buf_page_t*	bpage = buf_page_hash_get_low(
+			buf_pool, page_id);
+
+		/* The page may have been evicted and possibly read
+		again since the request was made. Because we are
+		holding buf_pool->mutex, it cannot leave the LRU list
+		once we have found it. */
+		if (bpage != NULL
+		    && !buf_pool_watch_is_sentinel(buf_pool, bpage)
+		    && buf_page_in_file(bpage)
+		    && buf_page_peek_if_too_old(bpage)) {
+			buf_LRU_make_block_young(bpage);
+		}
+
+		rw_lock_s_unlock(hash_lock);
+	}
+}
+
 /******************************************************************//**
 Try to free a block.  If bpage is a descriptor of a compressed-only
 page, the descriptor object will be freed as well.
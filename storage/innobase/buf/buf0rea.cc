@@ -817,6 +817,91 @@ buf_read_ahead_linear(
 	return(count);
 }
 
+/** Issue asynchronous read requests for index leaf pages that a range scan
+is about to access.
+NOTE: the calling thread may own latches on pages: to avoid deadlocks this
+function must be written such that it cannot end up waiting for these
+latches!
+@param[in]	space_id	tablespace identifier
+@param[in]	page_size	page size
+@param[in]	page_nos	page numbers, in the order of access
+@param[in]	n		number of elements in page_nos
+@return number of page read requests issued */
+ulint
+buf_read_ahead_range(
+	ulint			space_id,
+	const page_size_t&	page_size,
+	const ulint*		page_nos,
+	ulint			n)
+{
+	if (srv_startup_is_before_trx_rollback_phase) {
+		/* No read-ahead to avoid thread deadlocks */
+		return(0);
+	}
+
+	ulint	count = 0;
+
+	os_aio_simulated_put_read_threads_to_sleep();
+
+	for (ulint i = 0; i < n; i++) {
+		const page_id_t	page_id(space_id, page_nos[i]);
+		buf_pool_t*	buf_pool = buf_pool_get(page_id);
+
+		/* Like the other read-ahead methods, give way to
+		the reads that somebody is waiting for. */
+		if (buf_pool->n_pend_reads
+		    > buf_pool->curr_size / BUF_READ_AHEAD_PEND_LIMIT) {
+			break;
+		}
+
+		dberr_t	err;
+		ulint	n_read = buf_read_page_low(
+			&err, false,
+			IORequest::DO_NOT_WAKE | IORequest::IGNORE_MISSING,
+			BUF_READ_ANY_PAGE, page_id, page_size, false);
+
+		switch (err) {
+		case DB_SUCCESS:
+		case DB_TABLESPACE_TRUNCATED:
+		case DB_TABLESPACE_DELETED:
+		case DB_ERROR:
+			break;
+		case DB_PAGE_CORRUPTED:
+		case DB_DECRYPTION_FAILED:
+			ib::error() << "range readahead failed to"
+				" read or decrypt " << page_id;
+			break;
+		default:
+			ut_error;
+		}
+
+		if (err == DB_TABLESPACE_DELETED) {
+			break;
+		}
+
+		buf_pool->stat.n_ra_pages_read += n_read;
+		count += n_read;
+	}
+
+	/* In simulated aio we wake the aio handler threads only after
+	queuing all aio requests, in native aio the following call does
+	nothing: */
+
+	os_aio_simulated_wake_handler_threads();
+
+	if (count) {
+		DBUG_PRINT("ib_buf", ("range read-ahead " ULINTPF " pages, "
+				      ULINTPF ":" ULINTPF,
+				      count, space_id, page_nos[0]));
+
+		/* Read ahead is considered one I/O operation for the
+		purpose of LRU policy decision. */
+		buf_LRU_stat_inc_io();
+	}
+
+	return(count);
+}
+
 /********************************************************************//**
 Issues read requests for pages which the ibuf module wants to read in, in
 order to contract the insert buffer tree. Technically, this function is like
@@ -1378,9 +1378,11 @@ dict_create_index_step(
 						node->table->fts->cache,
 						node->index);
 
-				if (index_cache->words) {
-					rbt_free(index_cache->words);
-					index_cache->words = 0;
+				for (ulint i = 0; i < FTS_NUM_AUX_INDEX; i++) {
+					if (index_cache->words[i]) {
+						rbt_free(index_cache->words[i]);
+						index_cache->words[i] = 0;
+					}
 				}
 
 				ib_vector_remove(
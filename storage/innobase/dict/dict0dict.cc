@@ -2514,6 +2514,7 @@ dict_index_add_to_cache(
 		       SYNC_INDEX_TREE);
 
 	new_index->n_core_fields = new_index->n_fields;
+	cmp_index_init(new_index);
 
 	dict_mem_index_free(index);
 	if (err) *err = DB_SUCCESS;
@@ -6147,6 +6148,85 @@ dict_index_set_merge_threshold(
 	rw_lock_x_unlock(dict_operation_lock);
 }
 
+/** Write SYS_INDEXES.TYPE of a secondary index with or without
+DICT_CORRUPT, without changing the data dictionary cache. This is used
+for marking an index that is being built without redo logging, so that
+it will be treated as corrupted if the server is killed before the
+index pages have been written.
+@param[in]	index		secondary index
+@param[in]	corrupted	whether to set DICT_CORRUPT */
+void
+dict_index_write_corrupted(const dict_index_t* index, bool corrupted)
+{
+	mem_heap_t*	heap;
+	mtr_t		mtr;
+	dict_index_t*	sys_index;
+	dtuple_t*	tuple;
+	dfield_t*	dfield;
+	byte*		buf;
+	btr_cur_t	cursor;
+
+	ut_ad(!dict_index_is_clust(index));
+	ut_ad(!dict_table_is_comp(dict_sys->sys_indexes));
+
+	if (srv_read_only_mode) {
+		return;
+	}
+
+	rw_lock_x_lock(dict_operation_lock);
+	mutex_enter(&dict_sys->mutex);
+
+	heap = mem_heap_create(sizeof(dtuple_t) + 2 * (sizeof(dfield_t)
+			       + 8));
+
+	mtr_start(&mtr);
+
+	sys_index = UT_LIST_GET_FIRST(dict_sys->sys_indexes->indexes);
+
+	/* Find the index row in SYS_INDEXES */
+	tuple = dtuple_create(heap, 2);
+
+	dfield = dtuple_get_nth_field(tuple, 0);
+	buf = static_cast<byte*>(mem_heap_alloc(heap, 8));
+	mach_write_to_8(buf, index->table->id);
+	dfield_set_data(dfield, buf, 8);
+
+	dfield = dtuple_get_nth_field(tuple, 1);
+	buf = static_cast<byte*>(mem_heap_alloc(heap, 8));
+	mach_write_to_8(buf, index->id);
+	dfield_set_data(dfield, buf, 8);
+
+	dict_index_copy_types(tuple, sys_index, 2);
+
+	btr_cur_search_to_nth_level(sys_index, 0, tuple, PAGE_CUR_LE,
+				    BTR_MODIFY_LEAF,
+				    &cursor, 0, __FILE__, __LINE__, &mtr);
+
+	if (cursor.low_match == dtuple_get_n_fields(tuple)) {
+		/* UPDATE SYS_INDEXES SET TYPE=index->type[|DICT_CORRUPT]
+		WHERE TABLE_ID=index->table->id AND INDEX_ID=index->id */
+		ulint	len;
+		byte*	field	= rec_get_nth_field_old(
+			btr_cur_get_rec(&cursor),
+			DICT_FLD__SYS_INDEXES__TYPE, &len);
+
+		ut_ad(len == 4);
+
+		if (len == 4) {
+			mlog_write_ulint(field,
+					 index->type
+					 | (corrupted ? DICT_CORRUPT : 0),
+					 MLOG_4BYTES, &mtr);
+		}
+	}
+
+	mtr_commit(&mtr);
+	mem_heap_free(heap);
+
+	mutex_exit(&dict_sys->mutex);
+	rw_lock_x_unlock(dict_operation_lock);
+}
+
 #ifdef UNIV_DEBUG
 /** Sets merge_threshold for all indexes in the list of tables
 @param[in]	list	pointer to the list of tables */
@@ -7072,9 +7152,15 @@ dict_index_zip_pad_optimal_page_size(
 
 	ut_ad(index);
 
+	/* Space reserved for the modification log by ZIP_LOG_PCT,
+	so that fewer modifications will require recompression. */
+	ut_ad(index->table->zip_log_pct < 100);
+	const ulint	max_sz = UNIV_PAGE_SIZE
+		- UNIV_PAGE_SIZE * index->table->zip_log_pct / 100;
+
 	if (!zip_failure_threshold_pct) {
 		/* Disabled by user. */
-		return(UNIV_PAGE_SIZE);
+		return(max_sz);
 	}
 
 	pad = my_atomic_loadlint(&index->zip_pad.pad);
@@ -7086,7 +7172,7 @@ dict_index_zip_pad_optimal_page_size(
 	ut_ad(zip_pad_max < 100);
 	min_sz = (UNIV_PAGE_SIZE * (100 - zip_pad_max)) / 100;
 
-	return(ut_max(sz, min_sz));
+	return(ut_min(ut_max(sz, min_sz), max_sz));
 }
 
 /*************************************************************//**
@@ -1343,11 +1343,107 @@ dict_sys_tables_rec_read(
 	return(true);
 }
 
+/** A file-per-table tablespace that dict_check_sys_tables() found in
+SYS_TABLES but not in fil_system */
+struct dict_check_space_t {
+	ulint		space_id;	/*!< tablespace ID */
+	ulint		flags;		/*!< expected FSP_SPACE_FLAGS */
+	table_name_t	name;		/*!< table name */
+	char*		filepath;	/*!< path from SYS_DATAFILES, or NULL */
+	bool		parallel;	/*!< whether the tablespace can be
+					opened without the dictionary, because
+					it is in the default location */
+	bool		opened;		/*!< whether the tablespace was
+					opened */
+};
+
+/** The tablespaces that dict_check_sys_tables() opens on several threads */
+struct dict_check_spaces_t {
+	dict_check_space_t*	spaces;	/*!< the tablespaces */
+	ulint			n_spaces;/*!< number of elements in spaces[] */
+	ulint			next;	/*!< the next element of spaces[] to
+					open; accessed with my_atomic_addlint() */
+	bool			validate;/*!< whether to read and validate
+					the first page of the files */
+};
+
+/** Helper thread of dict_check_sys_tables() */
+struct dict_check_helper_t {
+	dict_check_spaces_t*	spaces;	/*!< the tablespaces */
+	os_thread_id_t		thread;	/*!< the thread */
+};
+
+/** Open the tablespaces in the default location until none are left.
+The other tablespaces are opened by dict_check_sys_tables() afterwards,
+because fil_ibd_open() may have to update SYS_DATAFILES for them.
+@param[in,out]	spaces	the tablespaces */
+static
+void
+dict_check_open_spaces(dict_check_spaces_t* spaces)
+{
+	for (;;) {
+		ulint	i = my_atomic_addlint(&spaces->next, 1);
+
+		if (i >= spaces->n_spaces) {
+			return;
+		}
+
+		dict_check_space_t&	space = spaces->spaces[i];
+
+		if (!space.parallel) {
+			continue;
+		}
+
+		/* An InnoDB Symbolic Link file would make fil_ibd_open()
+		look elsewhere, and possibly fix the dictionary. */
+		char*		link = fil_make_filepath(
+			NULL, space.name.m_name, ISL, false);
+		bool		exists;
+		os_file_type_t	type;
+
+		if (!link || !os_file_status(link, &exists, &type) || exists) {
+			ut_free(link);
+			space.parallel = false;
+			continue;
+		}
+
+		ut_free(link);
+
+		space.opened = fil_ibd_open(
+			spaces->validate, false, FIL_TYPE_TABLESPACE,
+			space.space_id, space.flags, space.name,
+			space.filepath) != NULL;
+	}
+}
+
+/** Helper thread of dict_check_sys_tables().
+@param[in,out]	arg	dict_check_helper_t
+@return OS_THREAD_DUMMY_RETURN */
+static
+os_thread_ret_t
+DECLARE_THREAD(dict_check_helper_thread)(void* arg)
+{
+	dict_check_helper_t*	helper = static_cast<dict_check_helper_t*>(
+		arg);
+
+	my_thread_init();
+	dict_check_open_spaces(helper->spaces);
+	my_thread_end();
+
+	os_thread_exit(false);
+
+	OS_THREAD_DUMMY_RETURN;
+}
+
 /** Load and check each non-predefined tablespace mentioned in SYS_TABLES.
 Search SYS_TABLES and check each tablespace mentioned that has not
 already been added to the fil_system.  If it is valid, add it to the
 file_system list.  Perform extra validation on the table if recovery from
 the REDO log occurred.
+
+The tablespaces in the default location are opened on
+innodb_tablespace_open_threads threads; the rest, which may require
+SYS_DATAFILES to be updated, are opened afterwards by this thread.
 @param[in]	validate	Whether to do validation on the table.
 @return the highest space ID found. */
 UNIV_INLINE
@@ -1359,6 +1455,9 @@ dict_check_sys_tables(
 	btr_pcur_t	pcur;
 	const rec_t*	rec;
 	mtr_t		mtr;
+	std::vector<dict_check_space_t, ut_allocator<dict_check_space_t> >
+			to_open;
+	std::set<ulint>	space_ids;
 
 	DBUG_ENTER("dict_check_sys_tables");
 
@@ -1448,28 +1547,87 @@ dict_check_sys_tables(
 		location) or this path is the same file but looks different,
 		fil_ibd_open() will update the dictionary with what is
 		opened. */
-		char*	filepath = dict_get_first_path(space_id);
+		dict_check_space_t	space;
+
+		space.space_id = space_id;
+		space.flags = dict_tf_to_fsp_flags(flags);
+		space.name = table_name;
+		space.filepath = dict_get_first_path(space_id);
+		space.opened = false;
+		/* A tablespace ID that occurs twice is left to
+		fil_ibd_open() on this thread, to report the conflict. */
+		space.parallel = !DICT_TF_HAS_DATA_DIR(flags)
+			&& space.flags != ULINT_UNDEFINED
+			&& space_ids.insert(space_id).second;
+
+		if (space.parallel && space.filepath) {
+			char*	default_path = fil_make_filepath(
+				NULL, table_name.m_name, IBD, false);
+			space.parallel = default_path
+				&& !strcmp(default_path, space.filepath);
+			ut_free(default_path);
+		}
+
+		to_open.push_back(space);
+
+		max_space_id = ut_max(max_space_id, space_id);
+	}
+
+	mtr_commit(&mtr);
+
+	dict_check_spaces_t	spaces;
+
+	spaces.spaces = to_open.empty() ? NULL : &to_open[0];
+	spaces.n_spaces = to_open.size();
+	spaces.next = 0;
+	spaces.validate = validate;
+
+	const ulint		n_helpers = std::min<ulint>(
+		srv_n_tablespace_open_threads, spaces.n_spaces / 2 + 1) - 1;
+	dict_check_helper_t*	helpers = NULL;
+
+	if (n_helpers) {
+		helpers = static_cast<dict_check_helper_t*>(
+			ut_zalloc_nokey(n_helpers * sizeof *helpers));
+	}
+
+	for (ulint i = 0; i < n_helpers; i++) {
+		helpers[i].spaces = &spaces;
+		os_thread_create(dict_check_helper_thread, &helpers[i],
+				 &helpers[i].thread);
+	}
+
+	dict_check_open_spaces(&spaces);
+
+	for (ulint i = 0; i < n_helpers; i++) {
+		os_thread_join(helpers[i].thread);
+	}
+
+	ut_free(helpers);
+
+	for (ulint i = 0; i < spaces.n_spaces; i++) {
+		dict_check_space_t&	space = to_open[i];
 
 		/* Check that the .ibd file exists. */
-		if (!fil_ibd_open(
-			    validate,
-			    !srv_read_only_mode && srv_log_file_size != 0,
-			    FIL_TYPE_TABLESPACE,
-			    space_id, dict_tf_to_fsp_flags(flags),
-			    table_name, filepath)) {
+		if (!space.parallel) {
+			space.opened = fil_ibd_open(
+				validate,
+				!srv_read_only_mode && srv_log_file_size != 0,
+				FIL_TYPE_TABLESPACE,
+				space.space_id, space.flags,
+				space.name, space.filepath) != NULL;
+		}
+
+		if (!space.opened) {
 			ib::warn() << "Ignoring tablespace for "
-				<< table_name
+				<< space.name
 				<< " because it could not be opened.";
 		}
 
-		max_space_id = ut_max(max_space_id, space_id);
-
-		ut_free(table_name.m_name);
-		ut_free(filepath);
+		ut_free(space.name.m_name);
+		ut_free(space.filepath);
 	}
 
-	mtr_commit(&mtr);
-
 	DBUG_RETURN(max_space_id);
 }
 
@@ -200,7 +200,6 @@ struct fts_tokenize_param_t {
 /** Run SYNC on the table, i.e., write out data from the cache to the
 FTS auxiliary INDEX table and clear the cache at the end.
 @param[in,out]	sync		sync state
-@param[in]	unlock_cache	whether unlock cache lock when write node
 @param[in]	wait		whether wait when a sync is in progress
 @param[in]      has_dict        whether has dict operation lock
 @return DB_SUCCESS if all OK */
@@ -208,7 +207,6 @@ static
 dberr_t
 fts_sync(
 	fts_sync_t*	sync,
-	bool		unlock_cache,
 	bool		wait,
 	bool		has_dict);
 
@@ -220,6 +218,13 @@ fts_words_free(
 /*===========*/
 	ib_rbt_t*	words)		/*!< in: rb tree of words */
 	MY_ATTRIBUTE((nonnull));
+
+/** Release the shards of words that were written by a SYNC.
+@param[in,out]	index_cache	index cache */
+static
+void
+fts_index_cache_free_sync_words(
+	fts_index_cache_t*	index_cache);
 #ifdef FTS_CACHE_SIZE_DEBUG
 /****************************************************************//**
 Read the max cache size parameter from the config table. */
@@ -567,11 +572,13 @@ fts_index_cache_init(
 {
 	ulint			i;
 
-	ut_a(index_cache->words == NULL);
+	for (i = 0; i < FTS_NUM_AUX_INDEX; ++i) {
+		ut_a(index_cache->words[i] == NULL);
 
-	index_cache->words = rbt_create_arg_cmp(
-		sizeof(fts_tokenizer_word_t), innobase_fts_text_cmp,
-		(void*) index_cache->charset);
+		index_cache->words[i] = rbt_create_arg_cmp(
+			sizeof(fts_tokenizer_word_t), innobase_fts_text_cmp,
+			(void*) index_cache->charset);
+	}
 
 	ut_a(index_cache->doc_stats == NULL);
 
@@ -906,9 +913,16 @@ fts_drop_index(
 				if (index->index_fts_syncing) {
 					retry = true;
 				}
-				if (!retry && index_cache->words) {
-					fts_words_free(index_cache->words);
-					rbt_free(index_cache->words);
+				if (!retry) {
+					for (ulint i = 0;
+					     i < FTS_NUM_AUX_INDEX; i++) {
+						fts_words_free(
+							index_cache->words[i]);
+						rbt_free(index_cache->words[i]);
+					}
+
+					fts_index_cache_free_sync_words(
+						index_cache);
 					break;
 				}
 				DICT_BG_YIELD(trx);
@@ -1090,6 +1104,53 @@ fts_words_free(
 	}
 }
 
+/** Release the shards of words that were written by a SYNC.
+@param[in,out]	index_cache	index cache */
+static
+void
+fts_index_cache_free_sync_words(
+	fts_index_cache_t*	index_cache)
+{
+	for (ulint i = 0; i < FTS_NUM_AUX_INDEX; ++i) {
+
+		if (index_cache->sync_words[i] != NULL) {
+
+			fts_words_free(index_cache->sync_words[i]);
+
+			rbt_free(index_cache->sync_words[i]);
+
+			index_cache->sync_words[i] = NULL;
+		}
+	}
+}
+
+/** Free the query graphs of an index cache.
+@param[in,out]	index_cache	index cache */
+static
+void
+fts_index_cache_free_graphs(
+	fts_index_cache_t*	index_cache)
+{
+	for (ulint i = 0; i < FTS_NUM_AUX_INDEX; ++i) {
+
+		if (index_cache->ins_graph[i] != NULL) {
+
+			fts_que_graph_free_check_lock(
+				NULL, index_cache, index_cache->ins_graph[i]);
+
+			index_cache->ins_graph[i] = NULL;
+		}
+
+		if (index_cache->sel_graph[i] != NULL) {
+
+			fts_que_graph_free_check_lock(
+				NULL, index_cache, index_cache->sel_graph[i]);
+
+			index_cache->sel_graph[i] = NULL;
+		}
+	}
+}
+
 /** Clear cache.
 @param[in,out]	cache	fts cache */
 void
@@ -1105,32 +1166,18 @@ fts_cache_clear(
 		index_cache = static_cast<fts_index_cache_t*>(
 			ib_vector_get(cache->indexes, i));
 
-		fts_words_free(index_cache->words);
-
-		rbt_free(index_cache->words);
-
-		index_cache->words = NULL;
-
 		for (j = 0; j < FTS_NUM_AUX_INDEX; ++j) {
 
-			if (index_cache->ins_graph[j] != NULL) {
-
-				fts_que_graph_free_check_lock(
-					NULL, index_cache,
-					index_cache->ins_graph[j]);
+			fts_words_free(index_cache->words[j]);
 
-				index_cache->ins_graph[j] = NULL;
-			}
+			rbt_free(index_cache->words[j]);
 
-			if (index_cache->sel_graph[j] != NULL) {
+			index_cache->words[j] = NULL;
+		}
 
-				fts_que_graph_free_check_lock(
-					NULL, index_cache,
-					index_cache->sel_graph[j]);
+		fts_index_cache_free_sync_words(index_cache);
 
-				index_cache->sel_graph[j] = NULL;
-			}
-		}
+		fts_index_cache_free_graphs(index_cache);
 
 		index_cache->doc_stats = NULL;
 	}
@@ -1144,6 +1191,12 @@ fts_cache_clear(
 
 	mutex_enter((ib_mutex_t*) &cache->deleted_lock);
 	cache->deleted_doc_ids = NULL;
+
+	if (cache->sync->heap != NULL) {
+		mem_heap_free(cache->sync->heap);
+		cache->sync->heap = NULL;
+		cache->sync->deleted_doc_ids = NULL;
+	}
 	mutex_exit((ib_mutex_t*) &cache->deleted_lock);
 }
 
@@ -1208,33 +1261,28 @@ fts_get_index_get_doc(
 }
 #endif
 
-/**********************************************************************//**
-Find an existing word, or if not found, create one and return it.
-@return specified word token */
+/** Find an existing word in the index cache, or if not found, create one.
+@param[in,out]	cache		cache
+@param[in,out]	index_cache	index cache
+@param[in]	text		word
+@return the word */
 static
 fts_tokenizer_word_t*
-fts_tokenizer_word_get(
-/*===================*/
-	fts_cache_t*	cache,			/*!< in: cache */
-	fts_index_cache_t*
-			index_cache,		/*!< in: index cache */
-	fts_string_t*	text)			/*!< in: node text */
+fts_index_cache_word_get(
+	fts_cache_t*		cache,
+	fts_index_cache_t*	index_cache,
+	const fts_string_t*	text)
 {
-	fts_tokenizer_word_t*	word;
+	ib_rbt_t*		words;
 	ib_rbt_bound_t		parent;
 
 	ut_ad(rw_lock_own(&cache->lock, RW_LOCK_X));
 
-	/* If it is a stopword, do not index it */
-	if (!fts_check_token(text,
-		    cache->stopword_info.cached_stopword,
-		    index_cache->charset)) {
-
-		return(NULL);
-	}
+	words = index_cache->words[fts_select_index(
+		index_cache->charset, text->f_str, text->f_len)];
 
 	/* Check if we found a match, if not then add word to tree. */
-	if (rbt_search(index_cache->words, &parent, text) != 0) {
+	if (rbt_search(words, &parent, text) != 0) {
 		mem_heap_t*		heap;
 		fts_tokenizer_word_t	new_word;
 
@@ -1245,8 +1293,7 @@ fts_tokenizer_word_get(
 
 		fts_string_dup(&new_word.text, text, heap);
 
-		parent.last = rbt_add_node(
-			index_cache->words, &parent, &new_word);
+		parent.last = rbt_add_node(words, &parent, &new_word);
 
 		/* Take into account the RB tree memory use and the vector. */
 		cache->total_size += sizeof(new_word)
@@ -1255,12 +1302,35 @@ fts_tokenizer_word_get(
 			+ (sizeof(fts_node_t) * 4)
 			+ sizeof(*new_word.nodes);
 
-		ut_ad(rbt_validate(index_cache->words));
+		ut_ad(rbt_validate(words));
 	}
 
-	word = rbt_value(fts_tokenizer_word_t, parent.last);
+	return(rbt_value(fts_tokenizer_word_t, parent.last));
+}
+
+/**********************************************************************//**
+Find an existing word, or if not found, create one and return it.
+@return specified word token */
+static
+fts_tokenizer_word_t*
+fts_tokenizer_word_get(
+/*===================*/
+	fts_cache_t*	cache,			/*!< in: cache */
+	fts_index_cache_t*
+			index_cache,		/*!< in: index cache */
+	fts_string_t*	text)			/*!< in: node text */
+{
+	ut_ad(rw_lock_own(&cache->lock, RW_LOCK_X));
+
+	/* If it is a stopword, do not index it */
+	if (!fts_check_token(text,
+		    cache->stopword_info.cached_stopword,
+		    index_cache->charset)) {
+
+		return(NULL);
+	}
 
-	return(word);
+	return(fts_index_cache_word_get(cache, index_cache, text));
 }
 
 /**********************************************************************//**
@@ -1420,7 +1490,7 @@ fts_cache_add_doc(
 				ib_vector_last(word->nodes));
 		}
 
-		if (fts_node == NULL || fts_node->synced
+		if (fts_node == NULL
 		    || fts_node->ilist_size > FTS_ILIST_MAX_SIZE
 		    || doc_id < fts_node->last_doc_id) {
 
@@ -3448,7 +3518,7 @@ fts_add_doc_from_tuple(
 
                        if (cache->total_size > fts_max_cache_size / 5
                            || fts_need_sync) {
-                               fts_sync(cache->sync, true, false, false);
+                               fts_sync(cache->sync, false, false);
                        }
 
                        mtr_start(&mtr);
@@ -3626,7 +3696,7 @@ fts_add_doc_by_id(
 
 				DBUG_EXECUTE_IF(
 					"fts_instrument_sync_debug",
-					fts_sync(cache->sync, true, true, false);
+					fts_sync(cache->sync, true, false);
 				);
 
 				DEBUG_SYNC_C("fts_instrument_sync_request");
@@ -4012,95 +4082,71 @@ fts_sync_add_deleted_cache(
 	return(error);
 }
 
-/** Write the words and ilist to disk.
+/** Write the words of one shard of the cache generation that is being
+synced to the corresponding auxiliary INDEX table.
 @param[in,out]	trx		transaction
-@param[in]	index_cache	index cache
-@param[in]	unlock_cache	whether unlock cache when write node
+@param[in,out]	index_cache	index cache
+@param[in]	selected	shard, that is, auxiliary INDEX table number
 @return DB_SUCCESS if all went well else error code */
 static MY_ATTRIBUTE((nonnull, warn_unused_result))
 dberr_t
 fts_sync_write_words(
 	trx_t*			trx,
 	fts_index_cache_t*	index_cache,
-	bool			unlock_cache)
+	ulint			selected)
 {
 	fts_table_t	fts_table;
 	ulint		n_nodes = 0;
 	ulint		n_words = 0;
 	const ib_rbt_node_t* rbt_node;
 	dberr_t		error = DB_SUCCESS;
-	ibool		print_error = FALSE;
-	dict_table_t*	table = index_cache->index->table;
+	const ib_rbt_t*	words = index_cache->sync_words[selected];
 
 	FTS_INIT_INDEX_TABLE(
-		&fts_table, NULL, FTS_INDEX_TABLE, index_cache->index);
+		&fts_table, fts_get_suffix(selected), FTS_INDEX_TABLE,
+		index_cache->index);
 
-	n_words = rbt_size(index_cache->words);
+	n_words = rbt_size(words);
 
-	/* We iterate over the entire tree, even if there is an error,
-	since we want to free the memory used during caching. */
-	for (rbt_node = rbt_first(index_cache->words);
-	     rbt_node;
-	     rbt_node = rbt_next(index_cache->words, rbt_node)) {
+	ut_ad(rbt_validate(words));
+
+	for (rbt_node = rbt_first(words);
+	     rbt_node != NULL && error == DB_SUCCESS;
+	     rbt_node = rbt_next(words, rbt_node)) {
 
 		ulint			i;
-		ulint			selected;
 		fts_tokenizer_word_t*	word;
 
 		word = rbt_value(fts_tokenizer_word_t, rbt_node);
 
-		selected = fts_select_index(
-			index_cache->charset, word->text.f_str,
-			word->text.f_len);
+		ut_ad(fts_select_index(index_cache->charset, word->text.f_str,
+				       word->text.f_len) == selected);
 
-		fts_table.suffix = fts_get_suffix(selected);
-
-		/* We iterate over all the nodes even if there was an error */
-		for (i = 0; i < ib_vector_size(word->nodes); ++i) {
+		for (i = 0; i < ib_vector_size(word->nodes)
+		     && error == DB_SUCCESS; ++i) {
 
 			fts_node_t* fts_node = static_cast<fts_node_t*>(
 				ib_vector_get(word->nodes, i));
 
-			if (fts_node->synced) {
-				continue;
-			} else {
-				fts_node->synced = true;
-			}
-
-			/*FIXME: we need to handle the error properly. */
-			if (error == DB_SUCCESS) {
-				if (unlock_cache) {
-					rw_lock_x_unlock(
-						&table->fts->cache->lock);
-				}
-
-				error = fts_write_node(
-					trx,
-					&index_cache->ins_graph[selected],
-					&fts_table, &word->text, fts_node);
+			error = fts_write_node(
+				trx, &index_cache->ins_graph[selected],
+				&fts_table, &word->text, fts_node);
 
-				DEBUG_SYNC_C("fts_write_node");
-				DBUG_EXECUTE_IF("fts_write_node_crash",
-					DBUG_SUICIDE(););
+			DEBUG_SYNC_C("fts_write_node");
+			DBUG_EXECUTE_IF("fts_write_node_crash",
+				DBUG_SUICIDE(););
 
-				DBUG_EXECUTE_IF("fts_instrument_sync_sleep",
-					os_thread_sleep(1000000);
-				);
-
-				if (unlock_cache) {
-					rw_lock_x_lock(
-						&table->fts->cache->lock);
-				}
-			}
+			DBUG_EXECUTE_IF("fts_instrument_sync_sleep",
+				os_thread_sleep(1000000);
+			);
 		}
 
 		n_nodes += ib_vector_size(word->nodes);
+	}
 
-		if (error != DB_SUCCESS && !print_error) {
-			ib::error() << "(" << ut_strerr(error) << ") writing"
-				" word node to FTS auxiliary index table.";
-			print_error = TRUE;
-		}
+	if (error != DB_SUCCESS) {
+		ib::error() << "(" << ut_strerr(error) << ") writing"
+			" word node to FTS auxiliary index table.";
 	}
 
 	if (fts_enable_diag_print) {
@@ -4111,216 +4157,588 @@ fts_sync_write_words(
 	return(error);
 }
 
-/*********************************************************************//**
-Begin Sync, create transaction, acquire locks, etc. */
-static
-void
-fts_sync_begin(
-/*===========*/
-	fts_sync_t*	sync)			/*!< in: sync state */
+/** Write one shard of the cache generation that is being synced,
+for all the FTS indexes of the table.
+@param[in,out]	sync		sync state
+@param[in,out]	trx		transaction
+@param[in]	selected	shard, that is, auxiliary INDEX table number
+@return DB_SUCCESS if all went well else error code */
+static MY_ATTRIBUTE((nonnull, warn_unused_result))
+dberr_t
+fts_sync_write_shard(
+	fts_sync_t*	sync,
+	trx_t*		trx,
+	ulint		selected)
 {
 	fts_cache_t*	cache = sync->table->fts->cache;
+	dberr_t		error = DB_SUCCESS;
 
-	n_nodes = 0;
-	elapsed_time = 0;
-
-	sync->start_time = ut_time();
-
-	sync->trx = trx_create();
-	trx_start_internal(sync->trx);
+	for (ulint i = 0;
+	     i < ib_vector_size(cache->indexes) && error == DB_SUCCESS;
+	     ++i) {
+		fts_index_cache_t*	index_cache;
 
-	if (fts_enable_diag_print) {
-		ib::info() << "FTS SYNC for table " << sync->table->name
-			<< ", deleted count: "
-			<< ib_vector_size(cache->deleted_doc_ids)
-			<< " size: " << cache->total_size << " bytes";
-	}
-}
+		index_cache = static_cast<fts_index_cache_t*>(
+			ib_vector_get(cache->indexes, i));
 
-/*********************************************************************//**
-Run SYNC on the table, i.e., write out data from the index specific
-cache to the FTS aux INDEX table and FTS aux doc id stats table.
-@return DB_SUCCESS if all OK */
-static MY_ATTRIBUTE((nonnull, warn_unused_result))
-dberr_t
-fts_sync_index(
-/*===========*/
-	fts_sync_t*		sync,		/*!< in: sync state */
-	fts_index_cache_t*	index_cache)	/*!< in: index cache */
-{
-	trx_t*		trx = sync->trx;
+		if (index_cache->index->to_be_dropped
+		    || index_cache->index->table->to_be_dropped
+		    || index_cache->sync_words[selected] == NULL
+		    || rbt_empty(index_cache->sync_words[selected])) {
+			continue;
+		}
 
-	trx->op_info = "doing SYNC index";
+		if (fts_enable_diag_print) {
+			ib::info() << "SYNC words: "
+				<< rbt_size(index_cache->sync_words[selected])
+				<< " in " << fts_get_suffix(selected);
+		}
 
-	if (fts_enable_diag_print) {
-		ib::info() << "SYNC words: " << rbt_size(index_cache->words);
+		error = fts_sync_write_words(trx, index_cache, selected);
 	}
 
-	ut_ad(rbt_validate(index_cache->words));
-
-	return(fts_sync_write_words(trx, index_cache, sync->unlock_cache));
+	return(error);
 }
 
-/** Check if index cache has been synced completely
-@param[in,out]	index_cache	index cache
-@return true if index is synced, otherwise false. */
-static
-bool
-fts_sync_index_check(
-	fts_index_cache_t*	index_cache)
+/** Write shards of the cache generation that is being synced until
+none are left.
+@param[in,out]	sync	sync state
+@param[in,out]	trx	transaction
+@param[in,out]	next	next shard to write, shared by the SYNC threads
+@return DB_SUCCESS if all went well else error code */
+static MY_ATTRIBUTE((nonnull, warn_unused_result))
+dberr_t
+fts_sync_write_run(
+	fts_sync_t*	sync,
+	trx_t*		trx,
+	ulint*		next)
 {
-	const ib_rbt_node_t*	rbt_node;
-
-	for (rbt_node = rbt_first(index_cache->words);
-	     rbt_node != NULL;
-	     rbt_node = rbt_next(index_cache->words, rbt_node)) {
+	for (;;) {
+		ulint	selected = my_atomic_addlint(next, 1);
 
-		fts_tokenizer_word_t*	word;
-		word = rbt_value(fts_tokenizer_word_t, rbt_node);
+		if (selected >= FTS_NUM_AUX_INDEX) {
+			return(DB_SUCCESS);
+		}
 
-		fts_node_t*	fts_node;
-		fts_node = static_cast<fts_node_t*>(ib_vector_last(word->nodes));
+		dberr_t	error = fts_sync_write_shard(sync, trx, selected);
 
-		if (!fts_node->synced) {
-			return(false);
+		if (error != DB_SUCCESS) {
+			return(error);
 		}
 	}
-
-	return(true);
 }
 
-/** Reset synced flag in index cache when rollback
-@param[in,out]	index_cache	index cache */
+/** Helper thread of a parallel SYNC */
+struct fts_sync_helper_t {
+	fts_sync_t*		sync;		/*!< sync state */
+	trx_t*			trx;		/*!< transaction of the
+						helper, committed or rolled
+						back with the SYNC */
+	ulint*			next;		/*!< next shard to write */
+	bool			has_dict;	/*!< whether the SYNC caller
+						holds dict_operation_lock */
+	dberr_t			error;		/*!< outcome */
+	os_thread_id_t		thread;		/*!< the thread */
+};
+
+/** Helper thread of fts_sync_write().
+@param[in,out]	arg	fts_sync_helper_t
+@return OS_THREAD_DUMMY_RETURN */
 static
-void
-fts_sync_index_reset(
-	fts_index_cache_t*	index_cache)
+os_thread_ret_t
+DECLARE_THREAD(fts_sync_helper_thread)(void* arg)
 {
-	const ib_rbt_node_t*	rbt_node;
+	fts_sync_helper_t*	helper = static_cast<fts_sync_helper_t*>(arg);
 
-	for (rbt_node = rbt_first(index_cache->words);
-	     rbt_node != NULL;
-	     rbt_node = rbt_next(index_cache->words, rbt_node)) {
+	/* The SYNC caller holds dict_operation_lock in S mode to keep
+	DDL away from the table. Do not wait for the latch, because a
+	pending X-latch request would block this thread until the
+	caller, which waits for this thread, released its S-latch.
+	Leave the shards to the other SYNC threads instead. */
+	if (helper->has_dict) {
+		if (!rw_lock_s_lock_nowait(dict_operation_lock,
+					   __FILE__, __LINE__)) {
+			os_thread_exit(false);
+			OS_THREAD_DUMMY_RETURN;
+		}
 
-		fts_tokenizer_word_t*	word;
-		word = rbt_value(fts_tokenizer_word_t, rbt_node);
+		helper->trx->dict_operation_lock_mode = RW_S_LATCH;
+	}
 
-		fts_node_t*	fts_node;
-		fts_node = static_cast<fts_node_t*>(ib_vector_last(word->nodes));
+	helper->error = fts_sync_write_run(
+		helper->sync, helper->trx, helper->next);
 
-		fts_node->synced = false;
+	if (helper->has_dict) {
+		row_mysql_unfreeze_data_dictionary(helper->trx);
 	}
+
+	os_thread_exit(false);
+
+	OS_THREAD_DUMMY_RETURN;
 }
 
-/** Commit the SYNC, change state of processed doc ids etc.
-@param[in,out]	sync	sync state
-@return DB_SUCCESS if all OK */
-static  MY_ATTRIBUTE((nonnull, warn_unused_result))
+/** Note in the CONFIG table that the helper threads of a SYNC are
+about to write words, so that fts_sync_recover() can remove them if the
+server is killed before the SYNC commits. The note is committed at once.
+@param[in]	sync	sync state
+@return DB_SUCCESS if all went well else error code */
+static MY_ATTRIBUTE((nonnull, warn_unused_result))
 dberr_t
-fts_sync_commit(
-	fts_sync_t*	sync)
+fts_sync_set_pending(
+	const fts_sync_t*	sync)
 {
-	dberr_t		error;
-	trx_t*		trx = sync->trx;
-	fts_cache_t*	cache = sync->table->fts->cache;
-	doc_id_t	last_doc_id;
+	fts_table_t	fts_table;
+	byte		id[FTS_MAX_ID_LEN];
+	fts_string_t	value;
 
-	trx->op_info = "doing SYNC commit";
+	FTS_INIT_FTS_TABLE(&fts_table, "CONFIG", FTS_COMMON_TABLE,
+			   sync->table);
 
-	/* After each Sync, update the CONFIG table about the max doc id
-	we just sync-ed to index table */
-	error = fts_cmp_set_sync_doc_id(sync->table, sync->max_doc_id, FALSE,
-					&last_doc_id);
+	value.f_str = id;
+	value.f_len = snprintf(
+		(char*) id, sizeof(id), FTS_DOC_ID_FORMAT,
+		sync->table->fts->cache->synced_doc_id);
 
-	/* Get the list of deleted documents that are either in the
-	cache or were headed there but were deleted before the add
-	thread got to them. */
+	trx_t*	trx = trx_create();
+	trx_start_internal(trx);
 
-	if (error == DB_SUCCESS && ib_vector_size(cache->deleted_doc_ids) > 0) {
+	dberr_t	error = fts_config_set_value(
+		trx, &fts_table, FTS_SYNC_PENDING, &value);
 
-		error = fts_sync_add_deleted_cache(
-			sync, cache->deleted_doc_ids);
+	if (error == DB_SUCCESS) {
+		fts_sql_commit(trx);
+	} else {
+		fts_sql_rollback(trx);
 	}
 
-	/* We need to do this within the deleted lock since fts_delete() can
-	attempt to add a deleted doc id to the cache deleted id array. */
-	fts_cache_clear(cache);
-	DEBUG_SYNC_C("fts_deleted_doc_ids_clear");
-	fts_cache_init(cache);
-	rw_lock_x_unlock(&cache->lock);
+	trx_free(trx);
 
-	if (error == DB_SUCCESS) {
+	return(error);
+}
 
-		fts_sql_commit(trx);
+/** Remove the note of fts_sync_set_pending().
+@param[in]	table	table with FTS index
+@param[in,out]	trx	transaction
+@return DB_SUCCESS if all went well else error code */
+static MY_ATTRIBUTE((nonnull, warn_unused_result))
+dberr_t
+fts_sync_clear_pending(
+	const dict_table_t*	table,
+	trx_t*			trx)
+{
+	fts_table_t	fts_table;
+	char		table_name[MAX_FULL_NAME_LEN];
 
-	} else if (error != DB_SUCCESS) {
+	FTS_INIT_FTS_TABLE(&fts_table, "CONFIG", FTS_COMMON_TABLE, table);
 
-		fts_sql_rollback(trx);
+	pars_info_t*	info = pars_info_create();
 
-		ib::error() << "(" << ut_strerr(error) << ") during SYNC.";
-	}
+	fts_get_table_name(&fts_table, table_name);
+	pars_info_bind_id(info, true, "config_table", table_name);
 
-	if (fts_enable_diag_print && elapsed_time) {
-		ib::info() << "SYNC for table " << sync->table->name
-			<< ": SYNC time: "
-			<< (ut_time() - sync->start_time)
-			<< " secs: elapsed "
-			<< (double) n_nodes / elapsed_time
-			<< " ins/sec";
-	}
+	que_t*	graph = fts_parse_sql(
+		&fts_table, info,
+		"BEGIN DELETE FROM $config_table"
+		" WHERE key = '" FTS_SYNC_PENDING "';");
 
-	/* Avoid assertion in trx_free(). */
-	trx->dict_operation_lock_mode = 0;
-	trx_free(trx);
+	dberr_t	error = fts_eval_sql(trx, graph);
+
+	fts_que_graph_free_check_lock(&fts_table, NULL, graph);
 
 	return(error);
 }
 
-/** Rollback a sync operation
-@param[in,out]	sync	sync state */
+/** Remove the words that the helper threads of a SYNC committed before
+the server was killed, if the SYNC itself did not commit. The documents
+of the SYNC are then loaded to the cache again by fts_init_index(), as
+if the SYNC had never started.
+@param[in,out]	table	table with FTS index */
 static
 void
-fts_sync_rollback(
+fts_sync_recover(
+	dict_table_t*	table)
+{
+	fts_table_t	fts_table;
+	byte		id[FTS_MAX_CONFIG_VALUE_LEN + 1];
+	fts_string_t	value;
+	doc_id_t	doc_id;
+
+	if (srv_read_only_mode) {
+		return;
+	}
+
+	FTS_INIT_FTS_TABLE(&fts_table, "CONFIG", FTS_COMMON_TABLE, table);
+
+	value.f_str = id;
+	value.f_len = FTS_MAX_CONFIG_VALUE_LEN;
+
+	trx_t*	trx = trx_create();
+	trx_start_internal(trx);
+	trx->op_info = "recovering FTS SYNC";
+
+	dberr_t	error = fts_config_get_value(
+		trx, &fts_table, FTS_SYNC_PENDING, &value);
+
+	if (error != DB_SUCCESS
+	    || sscanf((char*) id, FTS_DOC_ID_FORMAT, &doc_id) != 1) {
+		fts_sql_commit(trx);
+		trx_free(trx);
+		return;
+	}
+
+	for (ulint i = 0;
+	     i < ib_vector_size(table->fts->indexes) && error == DB_SUCCESS;
+	     ++i) {
+		dict_index_t*	index = static_cast<dict_index_t*>(
+			ib_vector_getp(table->fts->indexes, i));
+
+		for (ulint j = 0;
+		     j < FTS_NUM_AUX_INDEX && error == DB_SUCCESS; ++j) {
+			doc_id_t	write_doc_id;
+			char		table_name[MAX_FULL_NAME_LEN];
+			pars_info_t*	info = pars_info_create();
+
+			FTS_INIT_INDEX_TABLE(
+				&fts_table, fts_get_suffix(j),
+				FTS_INDEX_TABLE, index);
+
+			fts_get_table_name(&fts_table, table_name);
+			pars_info_bind_id(
+				info, true, "index_table_name", table_name);
+
+			/* Convert to "storage" byte order. */
+			fts_write_doc_id((byte*) &write_doc_id, doc_id);
+			fts_bind_doc_id(info, "doc_id", &write_doc_id);
+
+			que_t*	graph = fts_parse_sql(
+				&fts_table, info,
+				"BEGIN DELETE FROM $index_table_name"
+				" WHERE first_doc_id > :doc_id;");
+
+			error = fts_eval_sql(trx, graph);
+
+			fts_que_graph_free(graph);
+		}
+	}
+
+	if (error == DB_SUCCESS) {
+		error = fts_update_sync_doc_id(table, NULL, doc_id, trx);
+	}
+
+	if (error == DB_SUCCESS) {
+		error = fts_sync_clear_pending(table, trx);
+	}
+
+	if (error == DB_SUCCESS) {
+		fts_sql_commit(trx);
+		table->fts->cache->synced_doc_id = doc_id;
+
+		ib::info() << "Removed the words of an interrupted SYNC"
+			" of FTS index table " << table->name;
+	} else {
+		ib::error() << "(" << ut_strerr(error) << ") while removing"
+			" the words of an interrupted SYNC of FTS index table "
+			<< table->name;
+
+		fts_sql_rollback(trx);
+	}
+
+	trx_free(trx);
+}
+
+/** Write the cache generation that is being synced to the auxiliary
+INDEX tables. The shards of a large generation are written in parallel,
+each helper thread using a transaction of its own.
+@param[in,out]	sync		sync state
+@param[out]	helpers		helper threads
+@param[out]	n_helpers	number of helper threads that were used
+@return DB_SUCCESS if all went well else error code */
+static MY_ATTRIBUTE((nonnull, warn_unused_result))
+dberr_t
+fts_sync_write(
+	fts_sync_t*		sync,
+	fts_sync_helper_t*	helpers,
+	ulint*			n_helpers)
+{
+	fts_cache_t*	cache = sync->table->fts->cache;
+	ulint		n_shards = 0;
+	ulint		next = 0;
+
+	sync->trx->op_info = "doing SYNC index";
+
+	for (ulint j = 0; j < FTS_NUM_AUX_INDEX; ++j) {
+		for (ulint i = 0; i < ib_vector_size(cache->indexes); ++i) {
+			const fts_index_cache_t*	index_cache;
+
+			index_cache = static_cast<const fts_index_cache_t*>(
+				ib_vector_get(cache->indexes, i));
+
+			if (index_cache->sync_words[j] != NULL
+			    && !rbt_empty(index_cache->sync_words[j])) {
+				++n_shards;
+				break;
+			}
+		}
+	}
+
+	*n_helpers = 0;
+
+	/* A small generation is written by this thread alone. So is any
+	generation when the caller holds dict_sys->mutex, because the
+	helpers would parse their INSERT statements without it. */
+	if (n_shards > 1
+	    && sync->sync_size >= fts_max_cache_size / 10
+	    && !(sync->table->fts->fts_status & TABLE_DICT_LOCKED)
+	    && fts_sync_set_pending(sync) == DB_SUCCESS) {
+		*n_helpers = n_shards - 1;
+	}
+
+	for (ulint i = 0; i < *n_helpers; i++) {
+		fts_sync_helper_t*	helper = &helpers[i];
+
+		helper->sync = sync;
+		helper->next = &next;
+		helper->error = DB_SUCCESS;
+		helper->trx = trx_create();
+		trx_start_internal(helper->trx);
+		helper->trx->op_info = "doing SYNC index";
+		helper->has_dict = sync->trx->dict_operation_lock_mode
+			== RW_S_LATCH;
+
+		os_thread_create(fts_sync_helper_thread, helper,
+				 &helper->thread);
+	}
+
+	dberr_t	error = fts_sync_write_run(sync, sync->trx, &next);
+
+	for (ulint i = 0; i < *n_helpers; i++) {
+		os_thread_join(helpers[i].thread);
+
+		if (error == DB_SUCCESS) {
+			error = helpers[i].error;
+		}
+	}
+
+	return(error);
+}
+
+/*********************************************************************//**
+Begin Sync, create transaction, acquire locks, etc. The words, doc stats
+and deleted doc ids that were cached so far are detached from the cache,
+so that new documents can be added while they are being written. */
+static
+void
+fts_sync_begin(
+/*===========*/
+	fts_sync_t*	sync)			/*!< in: sync state */
+{
+	fts_cache_t*	cache = sync->table->fts->cache;
+
+	ut_ad(rw_lock_own(&cache->lock, RW_LOCK_X));
+	ut_ad(sync->heap == NULL);
+
+	n_nodes = 0;
+	elapsed_time = 0;
+
+	sync->start_time = ut_time();
+
+	sync->trx = trx_create();
+	trx_start_internal(sync->trx);
+
+	if (fts_enable_diag_print) {
+		ib::info() << "FTS SYNC for table " << sync->table->name
+			<< ", deleted count: "
+			<< ib_vector_size(cache->deleted_doc_ids)
+			<< " size: " << cache->total_size << " bytes";
+	}
+
+	sync->sync_size = cache->total_size;
+	sync->sync_doc_id = sync->max_doc_id;
+
+	/* The sync takes over the heap of the current generation. */
+	sync->heap = static_cast<mem_heap_t*>(cache->sync_heap->arg);
+	cache->sync_heap->arg = mem_heap_create(1024);
+
+	cache->total_size = 0;
+	fts_need_sync = false;
+
+	mutex_enter(&cache->deleted_lock);
+	sync->deleted_doc_ids = cache->deleted_doc_ids;
+	cache->deleted_doc_ids = ib_vector_create(
+		cache->sync_heap, sizeof(fts_update_t), 4);
+	mutex_exit(&cache->deleted_lock);
+
+	for (ulint i = 0; i < ib_vector_size(cache->indexes); ++i) {
+		fts_index_cache_t*	index_cache;
+
+		index_cache = static_cast<fts_index_cache_t*>(
+			ib_vector_get(cache->indexes, i));
+
+		for (ulint j = 0; j < FTS_NUM_AUX_INDEX; ++j) {
+			ut_ad(index_cache->sync_words[j] == NULL);
+
+			index_cache->sync_words[j] = index_cache->words[j];
+			index_cache->words[j] = NULL;
+		}
+
+		/* The doc stats are not needed after the sync. */
+		index_cache->doc_stats = NULL;
+
+		fts_index_cache_init(cache->sync_heap, index_cache);
+
+		if (!index_cache->index->to_be_dropped
+		    && !index_cache->index->table->to_be_dropped) {
+			index_cache->index->index_fts_syncing = true;
+		}
+	}
+}
+
+/** Free the cache generation that has been synced.
+@param[in,out]	sync	sync state */
+static
+void
+fts_sync_free_generation(
 	fts_sync_t*	sync)
 {
-	trx_t*		trx = sync->trx;
 	fts_cache_t*	cache = sync->table->fts->cache;
 
+	ut_ad(rw_lock_own(&cache->lock, RW_LOCK_X));
+
 	for (ulint i = 0; i < ib_vector_size(cache->indexes); ++i) {
-		ulint			j;
 		fts_index_cache_t*	index_cache;
 
 		index_cache = static_cast<fts_index_cache_t*>(
 			ib_vector_get(cache->indexes, i));
 
-		/* Reset synced flag so nodes will not be skipped
-		in the next sync, see fts_sync_write_words(). */
-		fts_sync_index_reset(index_cache);
+		fts_index_cache_free_sync_words(index_cache);
 
-		for (j = 0; fts_index_selector[j].value; ++j) {
+		fts_index_cache_free_graphs(index_cache);
+	}
 
-			if (index_cache->ins_graph[j] != NULL) {
+	/* fts_cache_append_deleted_doc_ids() reads the deleted doc ids
+	of the generation under deleted_lock. */
+	mutex_enter(&cache->deleted_lock);
+	mem_heap_free(sync->heap);
+	sync->heap = NULL;
+	sync->deleted_doc_ids = NULL;
+	mutex_exit(&cache->deleted_lock);
+}
 
-				fts_que_graph_free_check_lock(
-					NULL, index_cache,
-					index_cache->ins_graph[j]);
+/** Return the cache generation that could not be synced to the cache,
+so that it will be written by the next SYNC.
+@param[in,out]	sync	sync state */
+static
+void
+fts_sync_restore_generation(
+	fts_sync_t*	sync)
+{
+	fts_cache_t*	cache = sync->table->fts->cache;
+
+	ut_ad(rw_lock_own(&cache->lock, RW_LOCK_X));
+
+	for (ulint i = 0; i < ib_vector_size(cache->indexes); ++i) {
+		fts_index_cache_t*	index_cache;
 
-				index_cache->ins_graph[j] = NULL;
+		index_cache = static_cast<fts_index_cache_t*>(
+			ib_vector_get(cache->indexes, i));
+
+		for (ulint j = 0; j < FTS_NUM_AUX_INDEX; ++j) {
+			ib_rbt_t*		words;
+			const ib_rbt_node_t*	rbt_node;
+
+			words = index_cache->sync_words[j];
+
+			if (words == NULL) {
+				/* The index was added during the sync. */
+				continue;
 			}
 
-			if (index_cache->sel_graph[j] != NULL) {
+			for (rbt_node = rbt_first(words);
+			     rbt_node != NULL;
+			     rbt_node = rbt_first(words)) {
+
+				const fts_tokenizer_word_t*	old_word;
+				fts_tokenizer_word_t*		word;
+				ib_vector_t*			nodes;
+				ulint				k;
+
+				old_word = rbt_value(
+					fts_tokenizer_word_t, rbt_node);
+
+				word = fts_index_cache_word_get(
+					cache, index_cache, &old_word->text);
+
+				/* The nodes that were added during the
+				sync follow the older ones. The ilists are
+				handed over to the new nodes. */
+				nodes = ib_vector_create(
+					cache->sync_heap, sizeof(fts_node_t),
+					ib_vector_size(old_word->nodes)
+					+ ib_vector_size(word->nodes));
+
+				for (k = 0; k < ib_vector_size(old_word->nodes);
+				     ++k) {
+					ib_vector_push(nodes, ib_vector_get(
+						old_word->nodes, k));
+				}
+
+				for (k = 0; k < ib_vector_size(word->nodes);
+				     ++k) {
+					ib_vector_push(nodes, ib_vector_get(
+						word->nodes, k));
+				}
 
-				fts_que_graph_free_check_lock(
-					NULL, index_cache,
-					index_cache->sel_graph[j]);
+				word->nodes = nodes;
 
-				index_cache->sel_graph[j] = NULL;
+				ut_free(rbt_remove_node(words, rbt_node));
 			}
+
+			rbt_free(words);
+			index_cache->sync_words[j] = NULL;
 		}
+
+		fts_index_cache_free_graphs(index_cache);
+	}
+
+	cache->total_size += sync->sync_size;
+
+	mutex_enter(&cache->deleted_lock);
+
+	for (ulint i = 0; i < ib_vector_size(sync->deleted_doc_ids); ++i) {
+		ib_vector_push(cache->deleted_doc_ids,
+			       ib_vector_get(sync->deleted_doc_ids, i));
 	}
 
+	mem_heap_free(sync->heap);
+	sync->heap = NULL;
+	sync->deleted_doc_ids = NULL;
+
+	mutex_exit(&cache->deleted_lock);
+}
+
+/** Rollback a sync operation
+@param[in,out]	sync		sync state
+@param[in,out]	helpers		helper threads
+@param[in]	n_helpers	number of helper threads */
+static
+void
+fts_sync_rollback(
+	fts_sync_t*		sync,
+	fts_sync_helper_t*	helpers,
+	ulint			n_helpers)
+{
+	trx_t*		trx = sync->trx;
+	fts_cache_t*	cache = sync->table->fts->cache;
+
+	rw_lock_x_lock(&cache->lock);
+	fts_sync_restore_generation(sync);
 	rw_lock_x_unlock(&cache->lock);
 
+	for (ulint i = 0; i < n_helpers; i++) {
+		fts_sql_rollback(helpers[i].trx);
+		trx_free(helpers[i].trx);
+	}
+
 	fts_sql_rollback(trx);
 
 	/* Avoid assertion in trx_free(). */
@@ -4328,10 +4746,89 @@ fts_sync_rollback(
 	trx_free(trx);
 }
 
+/** Commit the SYNC, change state of processed doc ids etc.
+@param[in,out]	sync		sync state
+@param[in,out]	helpers		helper threads
+@param[in]	n_helpers	number of helper threads
+@return DB_SUCCESS if all OK */
+static  MY_ATTRIBUTE((nonnull, warn_unused_result))
+dberr_t
+fts_sync_commit(
+	fts_sync_t*		sync,
+	fts_sync_helper_t*	helpers,
+	ulint			n_helpers)
+{
+	dberr_t		error;
+	trx_t*		trx = sync->trx;
+	fts_cache_t*	cache = sync->table->fts->cache;
+	doc_id_t	last_doc_id;
+
+	trx->op_info = "doing SYNC commit";
+
+	/* After each Sync, update the CONFIG table about the max doc id
+	we just sync-ed to index table */
+	error = fts_cmp_set_sync_doc_id(sync->table, sync->sync_doc_id, FALSE,
+					&last_doc_id);
+
+	/* Get the list of deleted documents that are either in the
+	cache or were headed there but were deleted before the add
+	thread got to them. */
+
+	if (error == DB_SUCCESS && ib_vector_size(sync->deleted_doc_ids) > 0) {
+
+		error = fts_sync_add_deleted_cache(
+			sync, sync->deleted_doc_ids);
+	}
+
+	/* The helper transactions commit before this one. Until this
+	one commits, fts_sync_recover() would remove their words. */
+	if (error == DB_SUCCESS) {
+		error = fts_sync_clear_pending(sync->table, trx);
+	}
+
+	if (error != DB_SUCCESS) {
+
+		ib::error() << "(" << ut_strerr(error) << ") during SYNC.";
+
+		fts_sync_rollback(sync, helpers, n_helpers);
+
+		return(error);
+	}
+
+	rw_lock_x_lock(&cache->lock);
+	fts_sync_free_generation(sync);
+	DEBUG_SYNC_C("fts_deleted_doc_ids_clear");
+	rw_lock_x_unlock(&cache->lock);
+
+	for (ulint i = 0; i < n_helpers; i++) {
+		fts_sql_commit(helpers[i].trx);
+		trx_free(helpers[i].trx);
+	}
+
+	DBUG_EXECUTE_IF("fts_sync_helpers_crash",
+			if (n_helpers) DBUG_SUICIDE(););
+
+	fts_sql_commit(trx);
+
+	if (fts_enable_diag_print && elapsed_time) {
+		ib::info() << "SYNC for table " << sync->table->name
+			<< ": SYNC time: "
+			<< (ut_time() - sync->start_time)
+			<< " secs: elapsed "
+			<< (double) n_nodes / elapsed_time
+			<< " ins/sec";
+	}
+
+	/* Avoid assertion in trx_free(). */
+	trx->dict_operation_lock_mode = 0;
+	trx_free(trx);
+
+	return(error);
+}
+
 /** Run SYNC on the table, i.e., write out data from the cache to the
 FTS auxiliary INDEX table and clear the cache at the end.
 @param[in,out]	sync		sync state
-@param[in]	unlock_cache	whether unlock cache lock when write node
 @param[in]	wait		whether wait when a sync is in progress
 @param[in]      has_dict        whether has dict operation lock
 @return DB_SUCCESS if all OK */
@@ -4339,7 +4836,6 @@ static
 dberr_t
 fts_sync(
 	fts_sync_t*	sync,
-	bool		unlock_cache,
 	bool		wait,
 	bool		has_dict)
 {
@@ -4347,15 +4843,17 @@ fts_sync(
 		return DB_READ_ONLY;
 	}
 
-	ulint		i;
-	dberr_t		error = DB_SUCCESS;
-	fts_cache_t*	cache = sync->table->fts->cache;
+	ulint			i;
+	dberr_t			error;
+	fts_cache_t*		cache = sync->table->fts->cache;
+	fts_sync_helper_t	helpers[FTS_NUM_AUX_INDEX];
+	ulint			n_helpers;
 
 	rw_lock_x_lock(&cache->lock);
 
-	/* Check if cache is being synced.
-	Note: we release cache lock in fts_sync_write_words() to
-	avoid long wait for the lock by other threads. */
+	/* Check if cache is being synced. The cache lock is not held
+	while the detached generation is being written, so that
+	documents can be added to the cache meanwhile. */
 	while (sync->in_progress) {
 		rw_lock_x_unlock(&cache->lock);
 
@@ -4368,77 +4866,34 @@ fts_sync(
 		rw_lock_x_lock(&cache->lock);
 	}
 
-	sync->unlock_cache = unlock_cache;
 	sync->in_progress = true;
 
 	DEBUG_SYNC_C("fts_sync_begin");
 	fts_sync_begin(sync);
 
+	rw_lock_x_unlock(&cache->lock);
+
 	/* When sync in background, we hold dict operation lock
 	to prevent DDL like DROP INDEX, etc. */
 	if (has_dict) {
 		sync->trx->dict_operation_lock_mode = RW_S_LATCH;
 	}
 
-begin_sync:
-	if (cache->total_size > fts_max_cache_size) {
-		/* Avoid the case: sync never finish when
-		insert/update keeps comming. */
-		ut_ad(sync->unlock_cache);
-		sync->unlock_cache = false;
-	}
+	DBUG_EXECUTE_IF("fts_instrument_sync_sleep_drop_waits",
+			os_thread_sleep(10000000);
+			);
 
-	for (i = 0; i < ib_vector_size(cache->indexes); ++i) {
-		fts_index_cache_t*	index_cache;
-
-		index_cache = static_cast<fts_index_cache_t*>(
-			ib_vector_get(cache->indexes, i));
-
-		if (index_cache->index->to_be_dropped
-		   || index_cache->index->table->to_be_dropped) {
-			continue;
-		}
-
-		index_cache->index->index_fts_syncing = true;
-		DBUG_EXECUTE_IF("fts_instrument_sync_sleep_drop_waits",
-				os_thread_sleep(10000000);
-				);
-
-		error = fts_sync_index(sync, index_cache);
-
-		if (error != DB_SUCCESS && !sync->interrupted) {
-
-			goto end_sync;
-		}
-	}
+	error = fts_sync_write(sync, helpers, &n_helpers);
 
 	DBUG_EXECUTE_IF("fts_instrument_sync_interrupted",
 			sync->interrupted = true;
 			error = DB_INTERRUPTED;
-			goto end_sync;
 	);
 
-	/* Make sure all the caches are synced. */
-	for (i = 0; i < ib_vector_size(cache->indexes); ++i) {
-		fts_index_cache_t*	index_cache;
-
-		index_cache = static_cast<fts_index_cache_t*>(
-			ib_vector_get(cache->indexes, i));
-
-		if (index_cache->index->to_be_dropped
-		    || index_cache->index->table->to_be_dropped
-		    || fts_sync_index_check(index_cache)) {
-			continue;
-		}
-
-		goto begin_sync;
-	}
-
-end_sync:
 	if (error == DB_SUCCESS && !sync->interrupted) {
-		error = fts_sync_commit(sync);
+		error = fts_sync_commit(sync, helpers, n_helpers);
 	} else {
-		fts_sync_rollback(sync);
+		fts_sync_rollback(sync, helpers, n_helpers);
 	}
 
 	rw_lock_x_lock(&cache->lock);
@@ -4472,14 +4927,12 @@ fts_sync(
 /** Run SYNC on the table, i.e., write out data from the cache to the
 FTS auxiliary INDEX table and clear the cache at the end.
 @param[in,out]	table		fts table
-@param[in]	unlock_cache	whether unlock cache when write node
 @param[in]	wait		whether wait for existing sync to finish
 @param[in]	has_dict	whether has dict operation lock
 @return DB_SUCCESS on success, error code on failure. */
 dberr_t
 fts_sync_table(
 	dict_table_t*	table,
-	bool		unlock_cache,
 	bool		wait,
 	bool		has_dict)
 {
@@ -4489,8 +4942,7 @@ fts_sync_table(
 
 	if (!dict_table_is_discarded(table) && table->fts->cache
 	    && !dict_table_is_corrupted(table)) {
-		err = fts_sync(table->fts->cache->sync,
-			       unlock_cache, wait, has_dict);
+		err = fts_sync(table->fts->cache->sync, wait, has_dict);
 	}
 
 	return(err);
@@ -5301,10 +5753,14 @@ const ib_vector_t*
 fts_cache_find_word(
 /*================*/
 	const fts_index_cache_t*index_cache,	/*!< in: cache to search */
-	const fts_string_t*	text)		/*!< in: word to search for */
+	const fts_string_t*	text,		/*!< in: word to search for */
+	bool			syncing)	/*!< in: whether to search the
+						words that are being synced
+						instead of the current ones */
 {
 	ib_rbt_bound_t		parent;
 	const ib_vector_t*	nodes = NULL;
+	const ib_rbt_t*		words;
 #ifdef UNIV_DEBUG
 	dict_table_t*		table = index_cache->index->table;
 	fts_cache_t*		cache = table->fts->cache;
@@ -5312,8 +5768,12 @@ fts_cache_find_word(
 	ut_ad(rw_lock_own(&cache->lock, RW_LOCK_X));
 #endif /* UNIV_DEBUG */
 
+	words = (syncing ? index_cache->sync_words : index_cache->words)[
+		fts_select_index(index_cache->charset, text->f_str,
+				 text->f_len)];
+
 	/* Lookup the word in the rb tree */
-	if (rbt_search(index_cache->words, &parent, text) == 0) {
+	if (words != NULL && rbt_search(words, &parent, text) == 0) {
 		const fts_tokenizer_word_t*	word;
 
 		word = rbt_value(fts_tokenizer_word_t, parent.last);
@@ -5339,14 +5799,26 @@ fts_cache_append_deleted_doc_ids(
 		return;
 	}
 
+	/* The doc ids that were deleted before a SYNC began are not
+	in the DELETED_CACHE table until the SYNC commits. */
+	const ib_vector_t*	deleted[2] = {
+		cache->sync->deleted_doc_ids, cache->deleted_doc_ids
+	};
 
-	for (ulint i = 0; i < ib_vector_size(cache->deleted_doc_ids); ++i) {
-		fts_update_t*	update;
+	for (ulint j = 0; j < array_elements(deleted); ++j) {
 
-		update = static_cast<fts_update_t*>(
-			ib_vector_get(cache->deleted_doc_ids, i));
+		if (deleted[j] == NULL) {
+			continue;
+		}
 
-		ib_vector_push(vector, &update->doc_id);
+		for (ulint i = 0; i < ib_vector_size(deleted[j]); ++i) {
+			const fts_update_t*	update;
+
+			update = static_cast<const fts_update_t*>(
+				ib_vector_get_const(deleted[j], i));
+
+			ib_vector_push(vector, &update->doc_id);
+		}
 	}
 
 	mutex_exit((ib_mutex_t*) &cache->deleted_lock);
@@ -7591,6 +8063,8 @@ fts_init_index(
 
 	need_init = true;
 
+	fts_sync_recover(table);
+
 	start_doc = cache->synced_doc_id;
 
 	if (!start_doc) {
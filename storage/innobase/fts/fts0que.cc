@@ -1008,33 +1008,26 @@ fts_query_check_node(
 	}
 }
 
-/*****************************************************************//**
-Search index cache for word with wildcard match.
+/** Search one shard of the words of an index cache with wildcard match.
+@param[in,out]	query		query instance
+@param[in]	index_cache	cache to search
+@param[in]	words		shard of words to search
+@param[in]	srch_text	prefix to search for
 @return number of words matched */
 static
 ulint
-fts_cache_find_wildcard(
-/*====================*/
-	fts_query_t*		query,		/*!< in: query instance */
-	const fts_index_cache_t*index_cache,	/*!< in: cache to search */
-	const fts_string_t*	token)		/*!< in: token to search */
+fts_cache_find_wildcard_low(
+	fts_query_t*		query,
+	const fts_index_cache_t*index_cache,
+	const ib_rbt_t*		words,
+	const fts_string_t*	srch_text)
 {
 	ib_rbt_bound_t		parent;
 	const ib_vector_t*	nodes = NULL;
-	fts_string_t		srch_text;
-	byte			term[FTS_MAX_WORD_LEN + 1];
 	ulint			num_word = 0;
 
-	srch_text.f_len = (token->f_str[token->f_len - 1] == '%')
-			? token->f_len - 1
-			: token->f_len;
-
-	strncpy((char*) term, (char*) token->f_str, srch_text.f_len);
-	term[srch_text.f_len] = '\0';
-	srch_text.f_str = term;
-
 	/* Lookup the word in the rb tree */
-	if (rbt_search_cmp(index_cache->words, &parent, &srch_text, NULL,
+	if (rbt_search_cmp(words, &parent, srch_text, NULL,
 			   innobase_fts_text_cmp_prefix) == 0) {
 		const fts_tokenizer_word_t*     word;
 		ulint				i;
@@ -1045,7 +1038,7 @@ fts_cache_find_wildcard(
 		cur_node = parent.last;
 
 		while (innobase_fts_text_cmp_prefix(
-			index_cache->charset, &srch_text, &word->text) == 0) {
+			index_cache->charset, srch_text, &word->text) == 0) {
 
 			nodes = word->nodes;
 
@@ -1060,7 +1053,7 @@ fts_cache_find_wildcard(
 
 				ret = rbt_search(query->word_freqs,
 						 &freq_parent,
-						 &srch_text);
+						 srch_text);
 
 				ut_a(ret == 0);
 
@@ -1069,7 +1062,7 @@ fts_cache_find_wildcard(
 					freq_parent.last);
 
 				query->error = fts_query_filter_doc_ids(
-					query, &srch_text,
+					query, srch_text,
 					word_freqs, node,
 					node->ilist, node->ilist_size, TRUE);
 
@@ -1081,12 +1074,10 @@ fts_cache_find_wildcard(
 			num_word++;
 
 			if (!forward) {
-				cur_node = rbt_prev(
-					index_cache->words, cur_node);
+				cur_node = rbt_prev(words, cur_node);
 			} else {
 cont_search:
-				cur_node = rbt_next(
-					index_cache->words, cur_node);
+				cur_node = rbt_next(words, cur_node);
 			}
 
 			if (!cur_node) {
@@ -1106,6 +1097,83 @@ fts_cache_find_wildcard(
 	return(num_word);
 }
 
+/*****************************************************************//**
+Search index cache for word with wildcard match.
+@return number of words matched */
+static
+ulint
+fts_cache_find_wildcard(
+/*====================*/
+	fts_query_t*		query,		/*!< in: query instance */
+	const fts_index_cache_t*index_cache,	/*!< in: cache to search */
+	const fts_string_t*	token)		/*!< in: token to search */
+{
+	fts_string_t		srch_text;
+	byte			term[FTS_MAX_WORD_LEN + 1];
+	ulint			num_word = 0;
+
+	srch_text.f_len = (token->f_str[token->f_len - 1] == '%')
+			? token->f_len - 1
+			: token->f_len;
+
+	strncpy((char*) term, (char*) token->f_str, srch_text.f_len);
+	term[srch_text.f_len] = '\0';
+	srch_text.f_str = term;
+
+	/* Words that compare equal to the prefix may be in any shard of
+	either the current words or the words that are being synced. */
+	for (ulint i = 0; i < FTS_NUM_AUX_INDEX; ++i) {
+		const ib_rbt_t*	shards[2] = {
+			index_cache->sync_words[i], index_cache->words[i]
+		};
+
+		for (ulint j = 0; j < array_elements(shards); ++j) {
+
+			if (shards[j] == NULL) {
+				continue;
+			}
+
+			num_word += fts_cache_find_wildcard_low(
+				query, index_cache, shards[j], &srch_text);
+
+			if (query->error != DB_SUCCESS) {
+				return(0);
+			}
+		}
+	}
+
+	return(num_word);
+}
+
+/** Check the cached nodes of a word against the query, in the words
+that are being synced as well as in the current ones.
+@param[in,out]	query		query instance
+@param[in]	index_cache	cache to search
+@param[in]	token		word to search for */
+static
+void
+fts_query_check_cached_word(
+	fts_query_t*		query,
+	const fts_index_cache_t*index_cache,
+	const fts_string_t*	token)
+{
+	for (ulint j = 0; j < 2; ++j) {
+		const ib_vector_t*	nodes;
+
+		nodes = fts_cache_find_word(index_cache, token, j == 0);
+
+		for (ulint i = 0; nodes && i < ib_vector_size(nodes)
+		     && query->error == DB_SUCCESS; ++i) {
+			const fts_node_t*	node;
+
+			node = static_cast<const fts_node_t*>(
+				ib_vector_get_const(nodes, i));
+
+			fts_query_check_node(query, token, node);
+		}
+	}
+}
+
 /*****************************************************************//**
 Set difference.
 @return DB_SUCCESS if all go well */
@@ -1137,9 +1205,7 @@ fts_query_difference(
 
 	/* There is nothing we can substract from an empty set. */
 	if (query->doc_ids && !rbt_empty(query->doc_ids)) {
-		ulint			i;
 		fts_fetch_t		fetch;
-		const ib_vector_t*	nodes;
 		const fts_index_cache_t*index_cache;
 		que_t*			graph = NULL;
 		fts_cache_t*		cache = table->fts->cache;
@@ -1158,17 +1224,7 @@ fts_query_difference(
 		    && query->flags != FTS_PHRASE) {
 			fts_cache_find_wildcard(query, index_cache, token);
 		} else {
-			nodes = fts_cache_find_word(index_cache, token);
-
-			for (i = 0; nodes && i < ib_vector_size(nodes)
-			     && query->error == DB_SUCCESS; ++i) {
-				const fts_node_t*	node;
-
-				node = static_cast<const fts_node_t*>(
-					ib_vector_get_const(nodes, i));
-
-				fts_query_check_node(query, token, node);
-			}
+			fts_query_check_cached_word(query, index_cache, token);
 		}
 
 		rw_lock_x_unlock(&cache->lock);
@@ -1230,9 +1286,7 @@ fts_query_intersect(
 	we know the intersection set is empty in advance. */
 	if (!(rbt_empty(query->doc_ids) && query->multi_exist)) {
 		ulint                   n_doc_ids = 0;
-		ulint			i;
 		fts_fetch_t		fetch;
-		const ib_vector_t*	nodes;
 		const fts_index_cache_t*index_cache;
 		que_t*			graph = NULL;
 		fts_cache_t*		cache = table->fts->cache;
@@ -1282,17 +1336,7 @@ fts_query_intersect(
 			/* Wildcard search the index cache */
 			fts_cache_find_wildcard(query, index_cache, token);
 		} else {
-			nodes = fts_cache_find_word(index_cache, token);
-
-			for (i = 0; nodes && i < ib_vector_size(nodes)
-			     && query->error == DB_SUCCESS; ++i) {
-				const fts_node_t*	node;
-
-				node = static_cast<const fts_node_t*>(
-					ib_vector_get_const(nodes, i));
-
-				fts_query_check_node(query, token, node);
-			}
+			fts_query_check_cached_word(query, index_cache, token);
 		}
 
 		rw_lock_x_unlock(&cache->lock);
@@ -1363,20 +1407,7 @@ fts_query_cache(
 		/* Wildcard search the index cache */
 		fts_cache_find_wildcard(query, index_cache, token);
 	} else {
-		const ib_vector_t*      nodes;
-		ulint			i;
-
-		nodes = fts_cache_find_word(index_cache, token);
-
-		for (i = 0; nodes && i < ib_vector_size(nodes)
-		     && query->error == DB_SUCCESS; ++i) {
-			const fts_node_t*	node;
-
-			node = static_cast<const fts_node_t*>(
-				ib_vector_get_const(nodes, i));
-
-			fts_query_check_node(query, token, node);
-		}
+		fts_query_check_cached_word(query, index_cache, token);
 	}
 
 	rw_lock_x_unlock(&cache->lock);
@@ -70,6 +70,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 #include "buf0dump.h"
 #include "buf0flu.h"
 #include "buf0lru.h"
+#include "buf0rea.h"
 #include "dict0boot.h"
 #include "btr0defragment.h"
 #include "dict0crea.h"
@@ -380,6 +381,23 @@ static TYPELIB innodb_stats_method_typelib = {
 	NULL
 };
 
+/** Possible values for system variable "innodb_unzip_lru_policy",
+in the order of enum buf_LRU_unzip_policy_t */
+static const char* innodb_unzip_lru_policy_names[] = {
+	"adaptive",
+	"keep_compressed",
+	"keep_uncompressed",
+	NullS
+};
+
+/** Enumeration of innodb_unzip_lru_policy */
+static TYPELIB innodb_unzip_lru_policy_typelib = {
+	array_elements(innodb_unzip_lru_policy_names) - 1,
+	"innodb_unzip_lru_policy_typelib",
+	innodb_unzip_lru_policy_names,
+	NULL
+};
+
 /** Possible values of the parameter innodb_checksum_algorithm */
 const char* innodb_checksum_algorithm_names[] = {
 	"crc32",
@@ -607,6 +625,7 @@ static PSI_mutex_info all_innodb_mutexes[] = {
 	PSI_KEY(trx_pool_manager_mutex),
 	PSI_KEY(srv_sys_mutex),
 	PSI_KEY(lock_mutex),
+	PSI_KEY(lock_rec_hash_mutex),
 	PSI_KEY(lock_wait_mutex),
 	PSI_KEY(trx_mutex),
 	PSI_KEY(srv_threads_mutex),
@@ -662,6 +681,7 @@ static PSI_thread_info	all_innodb_threads[] = {
 	PSI_KEY(io_write_thread),
 	PSI_KEY(page_cleaner_thread),
 	PSI_KEY(recv_writer_thread),
+	PSI_KEY(recv_apply_thread),
 	PSI_KEY(srv_error_monitor_thread),
 	PSI_KEY(srv_lock_timeout_thread),
 	PSI_KEY(srv_master_thread),
@@ -718,6 +738,9 @@ ha_create_table_option innodb_table_option_list[]=
   HA_TOPTION_ENUM("ENCRYPTED", encryption, "DEFAULT,YES,NO", 0),
   /* With this option the user defines the key identifier using for the encryption */
   HA_TOPTION_SYSVAR("ENCRYPTION_KEY_ID", encryption_key_id, default_encryption_key_id),
+  /* With this option the user can reserve space on ROW_FORMAT=COMPRESSED
+  pages for the modification log, to avoid recompression */
+  HA_TOPTION_NUMBER("ZIP_LOG_PCT", zip_log_pct, 0, 0, 75, 1),
 
   HA_TOPTION_END
 };
@@ -908,6 +931,12 @@ static MYSQL_THDVAR_BOOL(strict_mode, PLUGIN_VAR_OPCMDARG,
   "Use strict mode when evaluating create options.",
   NULL, NULL, TRUE);
 
+static MYSQL_THDVAR_BOOL(bulk_insert, PLUGIN_VAR_OPCMDARG,
+  "Lock an empty table exclusively when LOAD DATA or INSERT of many rows"
+  " starts, and build its secondary indexes by sorting at the end of"
+  " the statement.",
+  NULL, NULL, FALSE);
+
 static MYSQL_THDVAR_BOOL(ft_enable_stopword, PLUGIN_VAR_OPCMDARG,
   "Create FTS index with stopword.",
   NULL, NULL,
@@ -927,6 +956,23 @@ static MYSQL_THDVAR_STR(tmpdir,
   "Directory for temporary non-tablespace files.",
   innodb_tmpdir_validate, NULL, NULL);
 
+static MYSQL_THDVAR_ULONG(sort_merge_threads, PLUGIN_VAR_RQCMDARG,
+  "Number of threads merging the sorted runs of an index that is being"
+  " created by ALTER TABLE",
+  NULL, NULL, 1, 1, 64, 0);
+
+static MYSQL_THDVAR_ULONG(parallel_read_threads, PLUGIN_VAR_RQCMDARG,
+  "Number of threads counting the rows of a table for SELECT COUNT(*)"
+  " without a WHERE clause; 1 disables the parallel count",
+  NULL, NULL, 1, 1, 256, 0);
+
+static MYSQL_SYSVAR_ULONG(parallel_read_max_threads,
+  srv_parallel_read_max_threads,
+  PLUGIN_VAR_RQCMDARG,
+  "Maximum number of threads helping all the SELECT COUNT(*) statements"
+  " at a time; a statement that finds none free counts on its own thread",
+  NULL, NULL, 16, 0, 256, 0);
+
 static SHOW_VAR innodb_status_variables[]= {
   {"buffer_pool_dump_status",
   (char*) &export_vars.innodb_buffer_pool_dump_status,	  SHOW_CHAR},
@@ -970,6 +1016,10 @@ static SHOW_VAR innodb_status_variables[]= {
   (char*) &export_vars.innodb_buffer_pool_wait_free,	  SHOW_LONG},
   {"buffer_pool_write_requests",
   (char*) &export_vars.innodb_buffer_pool_write_requests, SHOW_LONG},
+  {"checkpoint_age",
+  (char*) &export_vars.innodb_checkpoint_age,		  SHOW_LONGLONG},
+  {"checkpoint_max_age",
+  (char*) &export_vars.innodb_checkpoint_max_age,	  SHOW_LONGLONG},
   {"data_fsyncs",
   (char*) &export_vars.innodb_data_fsyncs,		  SHOW_LONG},
   {"data_pending_fsyncs",
@@ -990,6 +1040,10 @@ static SHOW_VAR innodb_status_variables[]= {
   (char*) &export_vars.innodb_dblwr_pages_written,	  SHOW_LONG},
   {"dblwr_writes",
   (char*) &export_vars.innodb_dblwr_writes,		  SHOW_LONG},
+  {"log_checkpoint_waits",
+  (char*) &export_vars.innodb_log_checkpoint_waits,	  SHOW_LONG},
+  {"log_checkpoint_wait_time",
+  (char*) &export_vars.innodb_log_checkpoint_wait_time,	  SHOW_LONGLONG},
   {"log_waits",
   (char*) &export_vars.innodb_log_waits,		  SHOW_LONG},
   {"log_write_requests",
@@ -1848,6 +1902,17 @@ thd_innodb_tmpdir(
 	return(tmp_dir);
 }
 
+/** Get the value of innodb_sort_merge_threads.
+@param[in]	thd	thread handle, or NULL to query
+			the global innodb_sort_merge_threads
+@return number of threads for merging sorted index entries */
+ulong
+thd_sort_merge_threads(
+	THD*	thd)
+{
+	return(THDVAR(thd, sort_merge_threads));
+}
+
 /** Obtain the InnoDB transaction of a MySQL thread.
 @param[in,out]	thd	thread handle
 @return reference to transaction pointer */
@@ -2887,6 +2952,8 @@ innobase_copy_frm_flags_from_create_info(
 		create_info->stats_auto_recalc == HA_STATS_AUTO_RECALC_OFF);
 
 	innodb_table->stats_sample_pages = create_info->stats_sample_pages;
+	innodb_table->zip_log_pct = ulint(
+		create_info->option_struct->zip_log_pct);
 }
 
 /*********************************************************************//**
@@ -2922,6 +2989,8 @@ innobase_copy_frm_flags_from_table_share(
 		table_share->stats_auto_recalc == HA_STATS_AUTO_RECALC_OFF);
 
 	innodb_table->stats_sample_pages = table_share->stats_sample_pages;
+	innodb_table->zip_log_pct = ulint(
+		table_share->option_struct->zip_log_pct);
 }
 
 /*********************************************************************//**
@@ -2959,7 +3028,8 @@ ha_innobase::ha_innobase(
 			  |  (srv_force_primary_key ? HA_REQUIRE_PRIMARY_KEY : 0)
 		  ),
 	m_start_of_scan(),
-        m_mysql_has_locked()
+        m_mysql_has_locked(),
+	m_bulk_insert()
 {}
 
 /*********************************************************************//**
@@ -5101,6 +5171,11 @@ ha_innobase::table_flags() const
 
 	ulong const	tx_isolation = thd_tx_isolation(thd);
 
+	if (THDVAR(thd, parallel_read_threads) > 1) {
+		/* Let SELECT COUNT(*) invoke records(). */
+		flags |= HA_HAS_RECORDS;
+	}
+
 	if (tx_isolation <= ISO_READ_COMMITTED) {
 		return(flags);
 	}
@@ -8054,6 +8129,16 @@ ha_innobase::write_row(
 		build_template(true);
 	}
 
+	if (m_bulk_insert) {
+		m_bulk_insert = false;
+
+		error = row_bulk_insert_start(m_prebuilt);
+
+		if (error != DB_SUCCESS) {
+			goto report_error;
+		}
+	}
+
 	innobase_srv_conc_enter_innodb(m_prebuilt);
 
 	vers_set_fields = table->versioned_write(VERS_TRX_ID) ?
@@ -8222,6 +8307,106 @@ ha_innobase::write_row(
 	DBUG_RETURN(error_result);
 }
 
+static
+int
+innobase_get_mysql_key_number_for_index(
+	INNOBASE_SHARE*		share,
+	const TABLE*		table,
+	dict_table_t*		ib_table,
+	const dict_index_t*	index);
+
+/** Note that rows are about to be inserted in bulk by LOAD DATA or
+INSERT. If innodb_bulk_insert is set and the table is empty, the first
+write_row() will lock the table exclusively and the secondary indexes
+will only be built by end_bulk_insert().
+@param[in]	rows	estimated number of rows, or 0 if unknown
+@param[in]	flags	flags (ignored) */
+void
+ha_innobase::start_bulk_insert(ha_rows rows, uint flags)
+{
+	THD*	thd = ha_thd();
+
+	m_bulk_insert = false;
+
+	if (rows == 1 || !THDVAR(thd, bulk_insert)
+	    || table->triggers
+	    || thd_to_trx(thd)->duplicates) {
+		return;
+	}
+
+#ifdef WITH_WSREP
+	if (wsrep_on(thd)) {
+		return;
+	}
+#endif /* WITH_WSREP */
+
+	switch (thd_sql_command(thd)) {
+	case SQLCOM_LOAD:
+	case SQLCOM_INSERT:
+	case SQLCOM_INSERT_SELECT:
+	case SQLCOM_CREATE_TABLE:
+		m_bulk_insert = !m_prebuilt->bulk_trx_id;
+		break;
+	default:
+		break;
+	}
+}
+
+/** Build the secondary indexes that were skipped by the bulk insert.
+@return 0 or error code */
+int
+ha_innobase::end_bulk_insert()
+{
+	trx_t*		trx	= m_prebuilt->trx;
+	const trx_id_t	trx_id	= m_prebuilt->bulk_trx_id;
+
+	DBUG_ENTER("ha_innobase::end_bulk_insert");
+
+	m_bulk_insert = false;
+	m_prebuilt->bulk_trx_id = 0;
+
+	if (!trx_id || !trx_is_started(trx) || trx->id != trx_id) {
+		/* Nothing was deferred, or the transaction was
+		rolled back together with its inserts. */
+		DBUG_RETURN(0);
+	}
+
+	dict_table_t*	ib_table = m_prebuilt->table;
+	const ulint	n_indexes = UT_LIST_GET_LEN(ib_table->indexes) - 1;
+	mem_heap_t*	heap = mem_heap_create(
+		n_indexes * (sizeof(dict_index_t*) + sizeof(ulint)));
+	dict_index_t**	indexes = static_cast<dict_index_t**>(
+		mem_heap_alloc(heap, n_indexes * sizeof *indexes));
+	ulint*		key_numbers = static_cast<ulint*>(
+		mem_heap_alloc(heap, n_indexes * sizeof *key_numbers));
+	ulint		i = 0;
+
+	for (dict_index_t* index = dict_table_get_next_index(
+		     dict_table_get_first_index(ib_table));
+	     index != NULL;
+	     index = dict_table_get_next_index(index), i++) {
+		indexes[i] = index;
+		key_numbers[i] = ulint(innobase_get_mysql_key_number_for_index(
+					       m_share, table, ib_table,
+					       index));
+	}
+
+	ut_ad(i == n_indexes);
+
+	dberr_t	error = row_merge_bulk_build(
+		trx, ib_table, indexes, key_numbers, n_indexes, table);
+
+	mem_heap_free(heap);
+
+	if (error != DB_SUCCESS) {
+		/* Let info(HA_STATUS_ERRKEY) report trx->error_key_num. */
+		trx->error_info = NULL;
+	}
+
+	DBUG_RETURN(my_errno = convert_error_code_to_mysql(
+			    error, ib_table->flags, ha_thd()));
+}
+
 /** Fill the update vector's "old_vrow" field for those non-updated,
 but indexed columns. Such columns could stil present in the virtual
 index rec fields even if they are not updated (some other fields updated),
@@ -11686,6 +11871,17 @@ create_table_info_t::check_table_options()
 		}
 	}
 
+	if (options->zip_log_pct != 0
+	    && row_format != ROW_TYPE_COMPRESSED
+	    && !m_create_info->key_block_size) {
+		push_warning(
+			m_thd, Sql_condition::WARN_LEVEL_WARN,
+			HA_WRONG_CREATE_OPTION,
+			"InnoDB: ZIP_LOG_PCT requires"
+			" ROW_FORMAT=COMPRESSED");
+		return "ZIP_LOG_PCT";
+	}
+
 	/* If encryption is set up make sure that used key_id is found */
 	if (encrypt == FIL_ENCRYPTION_ON ||
 		(encrypt == FIL_ENCRYPTION_DEFAULT && srv_encrypt_tables)) {
@@ -13461,6 +13657,47 @@ ha_innobase::records_in_range(
 	DBUG_RETURN((ha_rows) n_rows);
 }
 
+/** Count the rows that are visible to the current statement, on
+innodb_parallel_read_threads threads.
+@return number of rows, or HA_POS_ERROR if the rows should be counted by
+reading them through the handler interface instead */
+ha_rows
+ha_innobase::records()
+{
+	DBUG_ENTER("ha_innobase::records");
+
+	update_thd(ha_thd());
+
+	dict_table_t*	table = m_prebuilt->table;
+	ulint		n_threads = THDVAR(m_user_thd, parallel_read_threads);
+
+	/* Locking reads, and tables whose rows cannot be read,
+	go through the normal code path. */
+	if (n_threads <= 1
+	    || m_prebuilt->select_lock_type != LOCK_NONE
+	    || table->is_temporary()
+	    || table->no_rollback()
+	    || !table->is_readable()
+	    || dict_index_is_corrupted(dict_table_get_first_index(table))) {
+		DBUG_RETURN(HA_POS_ERROR);
+	}
+
+	trx_t*	trx = m_prebuilt->trx;
+	ulint	n_rows;
+
+	trx->op_info = "counting rows";
+
+	innobase_srv_conc_enter_innodb(m_prebuilt);
+
+	dberr_t	err = row_count_clust_recs(m_prebuilt, n_threads, &n_rows);
+
+	innobase_srv_conc_exit_innodb(m_prebuilt);
+
+	trx->op_info = "";
+
+	DBUG_RETURN(err == DB_SUCCESS ? ha_rows(n_rows) : HA_POS_ERROR);
+}
+
 /*********************************************************************//**
 Gives an UPPER BOUND to the number of rows in a table. This is used in
 filesort.cc.
@@ -14353,7 +14590,7 @@ ha_innobase::optimize(
 	if (innodb_optimize_fulltext_only) {
 		if (m_prebuilt->table->fts && m_prebuilt->table->fts->cache
 		    && !dict_table_is_discarded(m_prebuilt->table)) {
-			fts_sync_table(m_prebuilt->table, false, true, false);
+			fts_sync_table(m_prebuilt->table, true, false);
 			fts_optimize_table(m_prebuilt->table);
 		}
 		return(HA_ADMIN_OK);
@@ -19340,6 +19577,13 @@ static MYSQL_SYSVAR_BOOL(doublewrite, innobase_use_doublewrite,
   " Disable with --skip-innodb-doublewrite.",
   NULL, NULL, TRUE);
 
+static MYSQL_SYSVAR_ULONG(doublewrite_file_pages, srv_doublewrite_file_pages,
+  PLUGIN_VAR_OPCMDARG | PLUGIN_VAR_READONLY,
+  "Size in pages of the doublewrite file ib_doublewriteN that holds the"
+  " batch flushes of buffer pool instance N"
+  " (0=use the doublewrite buffer in the system tablespace)",
+  NULL, NULL, 0, 0, 4096, 0);
+
 static MYSQL_SYSVAR_BOOL(use_atomic_writes, innobase_use_atomic_writes,
   PLUGIN_VAR_NOCMDARG | PLUGIN_VAR_READONLY,
   "Enable atomic writes, instead of using the doublewrite buffer, for files "
@@ -19530,6 +19774,14 @@ static MYSQL_SYSVAR_ULONG(flushing_avg_loops,
   "Number of iterations over which the background flushing is averaged.",
   NULL, NULL, 30, 1, 1000, 0);
 
+static MYSQL_SYSVAR_ULONG(flush_hot_page_interval,
+  srv_flush_hot_page_interval,
+  PLUGIN_VAR_RQCMDARG,
+  "A page that is modified again within this many milliseconds of being"
+  " written counts as a wasted write, and adaptive flushing defers pages"
+  " for which this keeps happening (0 disables this).",
+  NULL, NULL, 0, 0, 60000, 0);
+
 static MYSQL_SYSVAR_ULONG(max_purge_lag, srv_max_purge_lag,
   PLUGIN_VAR_RQCMDARG,
   "Desired maximum length of the purge queue (0 = no limit)",
@@ -19926,6 +20178,19 @@ static MYSQL_SYSVAR_ULONG(write_io_threads, innobase_write_io_threads,
   "Number of background write I/O threads in InnoDB.",
   NULL, NULL, 4, 1, 64, 0);
 
+static MYSQL_SYSVAR_ULONG(recovery_apply_threads, srv_n_recv_apply_threads,
+  PLUGIN_VAR_RQCMDARG | PLUGIN_VAR_READONLY,
+  "Number of threads that apply redo log records to the pages"
+  " during crash recovery.",
+  NULL, NULL, 1, 1, 64, 0);
+
+static MYSQL_SYSVAR_ULONG(tablespace_open_threads,
+  srv_n_tablespace_open_threads,
+  PLUGIN_VAR_RQCMDARG | PLUGIN_VAR_READONLY,
+  "Number of threads that open the file-per-table tablespaces"
+  " at startup.",
+  NULL, NULL, 1, 1, 64, 0);
+
 static MYSQL_SYSVAR_ULONG(force_recovery, srv_force_recovery,
   PLUGIN_VAR_RQCMDARG | PLUGIN_VAR_READONLY,
   "Helps to save your data in case the disk image of the database becomes corrupt.",
@@ -19961,6 +20226,13 @@ static MYSQL_SYSVAR_ULONG(log_write_ahead_size, srv_log_write_ahead_size,
   NULL, innodb_log_write_ahead_size_update,
   8*1024L, OS_FILE_LOG_BLOCK_SIZE, UNIV_PAGE_SIZE_DEF, OS_FILE_LOG_BLOCK_SIZE);
 
+static MYSQL_SYSVAR_BOOL(log_parallel_copy, srv_log_parallel_copy,
+  PLUGIN_VAR_OPCMDARG,
+  "Whether concurrent mini-transaction commits only reserve space in the"
+  " redo log buffer while holding the log mutex, and copy their log"
+  " records in parallel after releasing it",
+  NULL, NULL, FALSE);
+
 static MYSQL_SYSVAR_UINT(old_blocks_pct, innobase_old_blocks_pct,
   PLUGIN_VAR_RQCMDARG,
   "Percentage of the buffer pool to reserve for 'old' blocks.",
@@ -19973,6 +20245,15 @@ static MYSQL_SYSVAR_UINT(old_blocks_time, buf_LRU_old_threshold_ms,
   " The timeout is disabled if 0.",
   NULL, NULL, 1000, 0, UINT_MAX32, 0);
 
+static MYSQL_SYSVAR_ENUM(unzip_lru_policy, buf_LRU_unzip_policy,
+  PLUGIN_VAR_RQCMDARG,
+  "How to evict blocks of ROW_FORMAT=COMPRESSED tables from the"
+  " buffer pool. Possible values are ADAPTIVE (default; evict only the"
+  " uncompressed frame when the workload seems to be I/O bound),"
+  " KEEP_COMPRESSED (always evict the uncompressed frame first) and"
+  " KEEP_UNCOMPRESSED (always evict the whole block)",
+  NULL, NULL, BUF_LRU_UNZIP_ADAPTIVE, &innodb_unzip_lru_policy_typelib);
+
 static MYSQL_SYSVAR_LONG(open_files, innobase_open_files,
   PLUGIN_VAR_RQCMDARG | PLUGIN_VAR_READONLY,
   "How many files at the maximum InnoDB keeps open at the same time.",
@@ -20067,6 +20348,12 @@ static MYSQL_SYSVAR_BOOL(undo_log_truncate, srv_undo_log_truncate,
   "Enable or Disable Truncate of UNDO tablespace.",
   NULL, NULL, FALSE);
 
+static MYSQL_SYSVAR_BOOL(read_view_csn, srv_read_view_csn,
+  PLUGIN_VAR_OPCMDARG | PLUGIN_VAR_READONLY,
+  "Whether a read view consists of a commit sequence number instead of"
+  " a list of the active transactions (off by default)",
+  NULL, NULL, FALSE);
+
 /* Alias for innodb_undo_logs, this config variable is deprecated. */
 static MYSQL_SYSVAR_ULONG(rollback_segments, srv_undo_logs,
   PLUGIN_VAR_OPCMDARG,
@@ -20096,6 +20383,12 @@ static MYSQL_SYSVAR_BOOL(use_native_aio, srv_use_native_aio,
   "Use native AIO if supported on this platform.",
   NULL, NULL, TRUE);
 
+static MYSQL_SYSVAR_BOOL(use_io_uring, srv_use_io_uring,
+  PLUGIN_VAR_NOCMDARG | PLUGIN_VAR_READONLY,
+  "Use io_uring instead of libaio for native AIO on Linux,"
+  " if supported by the build and the kernel.",
+  NULL, NULL, FALSE);
+
 #ifdef HAVE_LIBNUMA
 static MYSQL_SYSVAR_BOOL(numa_interleave, srv_numa_interleave,
   PLUGIN_VAR_NOCMDARG | PLUGIN_VAR_READONLY,
@@ -20193,6 +20486,13 @@ static MYSQL_SYSVAR_ULONG(read_ahead_threshold, srv_read_ahead_threshold,
   " trigger a readahead.",
   NULL, NULL, 56, 0, 64, 0);
 
+static MYSQL_SYSVAR_ULONG(range_read_ahead, srv_range_read_ahead,
+  PLUGIN_VAR_RQCMDARG,
+  "Number of leaf pages ahead of an ascending index range scan that are"
+  " read asynchronously, as named by the node pointers of their parent"
+  " page; 0 disables this read-ahead.",
+  NULL, NULL, 0, 0, BUF_READ_AHEAD_RANGE_MAX, 0);
+
 static MYSQL_SYSVAR_STR(monitor_enable, innobase_enable_monitor_counter,
   PLUGIN_VAR_RQCMDARG,
   "Turn on a monitor counter",
@@ -20505,6 +20805,7 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
   MYSQL_SYSVAR(temp_data_file_path),
   MYSQL_SYSVAR(data_home_dir),
   MYSQL_SYSVAR(doublewrite),
+  MYSQL_SYSVAR(doublewrite_file_pages),
   MYSQL_SYSVAR(stats_include_delete_marked),
   MYSQL_SYSVAR(use_atomic_writes),
   MYSQL_SYSVAR(fast_shutdown),
@@ -20515,6 +20816,8 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
   MYSQL_SYSVAR(flush_log_at_trx_commit),
   MYSQL_SYSVAR(flush_method),
   MYSQL_SYSVAR(force_recovery),
+  MYSQL_SYSVAR(recovery_apply_threads),
+  MYSQL_SYSVAR(tablespace_open_threads),
   MYSQL_SYSVAR(fill_factor),
   MYSQL_SYSVAR(ft_cache_size),
   MYSQL_SYSVAR(ft_total_cache_size),
@@ -20534,6 +20837,7 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
   MYSQL_SYSVAR(log_file_size),
   MYSQL_SYSVAR(log_files_in_group),
   MYSQL_SYSVAR(log_write_ahead_size),
+  MYSQL_SYSVAR(log_parallel_copy),
   MYSQL_SYSVAR(log_group_home_dir),
   MYSQL_SYSVAR(log_compressed_pages),
   MYSQL_SYSVAR(max_dirty_pages_pct),
@@ -20542,10 +20846,12 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
   MYSQL_SYSVAR(adaptive_flushing),
   MYSQL_SYSVAR(flush_sync),
   MYSQL_SYSVAR(flushing_avg_loops),
+  MYSQL_SYSVAR(flush_hot_page_interval),
   MYSQL_SYSVAR(max_purge_lag),
   MYSQL_SYSVAR(max_purge_lag_delay),
   MYSQL_SYSVAR(old_blocks_pct),
   MYSQL_SYSVAR(old_blocks_time),
+  MYSQL_SYSVAR(unzip_lru_policy),
   MYSQL_SYSVAR(open_files),
   MYSQL_SYSVAR(optimize_fulltext_only),
   MYSQL_SYSVAR(rollback_on_timeout),
@@ -20570,7 +20876,11 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
   MYSQL_SYSVAR(replication_delay),
   MYSQL_SYSVAR(status_file),
   MYSQL_SYSVAR(strict_mode),
+  MYSQL_SYSVAR(bulk_insert),
   MYSQL_SYSVAR(sort_buffer_size),
+  MYSQL_SYSVAR(sort_merge_threads),
+  MYSQL_SYSVAR(parallel_read_threads),
+  MYSQL_SYSVAR(parallel_read_max_threads),
   MYSQL_SYSVAR(online_alter_log_max_size),
   MYSQL_SYSVAR(sync_spin_loops),
   MYSQL_SYSVAR(spin_wait_delay),
@@ -20583,6 +20893,7 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
   MYSQL_SYSVAR(autoinc_lock_mode),
   MYSQL_SYSVAR(version),
   MYSQL_SYSVAR(use_native_aio),
+  MYSQL_SYSVAR(use_io_uring),
 #ifdef HAVE_LIBNUMA
   MYSQL_SYSVAR(numa_interleave),
 #endif /* HAVE_LIBNUMA */
@@ -20597,6 +20908,7 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
 #endif /* WITH_INNODB_DISALLOW_WRITES */
   MYSQL_SYSVAR(random_read_ahead),
   MYSQL_SYSVAR(read_ahead_threshold),
+  MYSQL_SYSVAR(range_read_ahead),
   MYSQL_SYSVAR(read_only),
   MYSQL_SYSVAR(io_capacity),
   MYSQL_SYSVAR(io_capacity_max),
@@ -20626,6 +20938,7 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
   MYSQL_SYSVAR(max_undo_log_size),
   MYSQL_SYSVAR(purge_rseg_truncate_frequency),
   MYSQL_SYSVAR(undo_log_truncate),
+  MYSQL_SYSVAR(read_view_csn),
   MYSQL_SYSVAR(rollback_segments),
   MYSQL_SYSVAR(undo_directory),
   MYSQL_SYSVAR(undo_tablespaces),
@@ -20723,6 +21036,9 @@ i_s_innodb_sys_datafiles,
 i_s_innodb_sys_virtual,
 i_s_innodb_mutexes,
 i_s_innodb_sys_semaphore_waits,
+#ifdef BTR_CUR_HASH_ADAPT
+i_s_innodb_adaptive_hash_stats,
+#endif /* BTR_CUR_HASH_ADAPT */
 i_s_innodb_tablespaces_encryption,
 i_s_innodb_tablespaces_scrubbing
 maria_declare_plugin_end;
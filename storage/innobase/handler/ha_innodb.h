@@ -70,6 +70,10 @@ struct ha_table_option_struct
 						value OFF.*/
 	uint		encryption;		/*!<  DEFAULT, ON, OFF */
 	ulonglong	encryption_key_id;	/*!< encryption key id  */
+	ulonglong	zip_log_pct;		/*!< percentage of each
+						ROW_FORMAT=COMPRESSED page
+						to keep free for the
+						modification log */
 };
 /* JAN: TODO: MySQL 5.7 handler.h */
 struct st_handler_tablename
@@ -221,6 +225,8 @@ class ha_innobase: public handler
 		key_range*		min_key,
 		key_range*		max_key);
 
+	ha_rows records();
+
 	ha_rows estimate_rows_upper_bound();
 
 	void update_create_info(HA_CREATE_INFO* create_info);
@@ -437,6 +443,9 @@ class ha_innobase: public handler
 	bool is_thd_killed();
 
 protected:
+	void start_bulk_insert(ha_rows rows, uint flags);
+
+	int end_bulk_insert();
 
 	/**
 	MySQL calls this method at the end of each statement. This method
@@ -517,6 +526,10 @@ class ha_innobase: public handler
 
         /** If mysql has locked with external_lock() */
         bool                    m_mysql_has_locked;
+
+	/** whether the next write_row() should try
+	row_bulk_insert_start() */
+	bool			m_bulk_insert;
 };
 
 
@@ -1988,59 +1988,6 @@ innobase_col_to_mysql(
 	}
 }
 
-/*************************************************************//**
-Copies an InnoDB record to table->record[0]. */
-void
-innobase_rec_to_mysql(
-/*==================*/
-	struct TABLE*		table,	/*!< in/out: MySQL table */
-	const rec_t*		rec,	/*!< in: record */
-	const dict_index_t*	index,	/*!< in: index */
-	const ulint*		offsets)/*!< in: rec_get_offsets(
-					rec, index, ...) */
-{
-	uint	n_fields	= table->s->fields;
-
-	ut_ad(n_fields == dict_table_get_n_user_cols(index->table)
-	      - !!(DICT_TF2_FLAG_IS_SET(index->table,
-					DICT_TF2_FTS_HAS_DOC_ID)));
-
-	for (uint i = 0; i < n_fields; i++) {
-		Field*		field	= table->field[i];
-		ulint		ipos;
-		ulint		ilen;
-		const uchar*	ifield;
-		ulint prefix_col;
-
-		field->reset();
-
-		ipos = dict_index_get_nth_col_or_prefix_pos(
-			index, i, true, false, &prefix_col);
-
-		if (ipos == ULINT_UNDEFINED
-		    || rec_offs_nth_extern(offsets, ipos)) {
-null_field:
-			field->set_null();
-			continue;
-		}
-
-		ifield = rec_get_nth_cfield(rec, index, offsets, ipos, &ilen);
-
-		/* Assign the NULL flag */
-		if (ilen == UNIV_SQL_NULL) {
-			ut_ad(field->real_maybe_null());
-			goto null_field;
-		}
-
-		field->set_notnull();
-
-		innobase_col_to_mysql(
-			dict_field_get_col(
-				dict_index_get_nth_field(index, ipos)),
-			ifield, ilen, field);
-	}
-}
-
 /*************************************************************//**
 Copies an InnoDB index entry to table->record[0].
 This is used in preparation for print_keydup_error() from
@@ -54,6 +54,7 @@ Modified Dec 29, 2014 Jan Lindström (Added sys_semaphore_waits)
 #include "fts0opt.h"
 #include "fts0priv.h"
 #include "btr0btr.h"
+#include "btr0sea.h"
 #include "page0zip.h"
 #include "sync0arr.h"
 #include "fil0fil.h"
@@ -3205,6 +3206,24 @@ static ST_FIELD_INFO	i_s_fts_index_fields_info[] =
 	END_OF_ST_FIELD_INFO
 };
 
+/** Order cached words by their text in the collation of the index. */
+struct i_s_fts_word_less {
+	/** Constructor
+	@param[in]	cs	charset of the index */
+	explicit i_s_fts_word_less(const CHARSET_INFO* cs) : m_cs(cs) {}
+
+	/** @return true if lhs < rhs */
+	bool operator()(
+		const fts_tokenizer_word_t*	lhs,
+		const fts_tokenizer_word_t*	rhs) const
+	{
+		return(innobase_fts_text_cmp(m_cs, &lhs->text, &rhs->text) < 0);
+	}
+
+	/** charset of the index */
+	const CHARSET_INFO*	m_cs;
+};
+
 /*******************************************************************//**
 Go through the Doc Node and its ilist, fill the dynamic table
 INFORMATION_SCHEMA.INNODB_FT_INDEX_CACHED for one FTS index on the table.
@@ -3221,10 +3240,13 @@ i_s_fts_index_cache_fill_one_index(
 	TABLE*			table = (TABLE*) tables->table;
 	Field**			fields;
 	CHARSET_INFO*		index_charset;
-	const ib_rbt_node_t*	rbt_node;
 	uint			dummy_errors;
 	char*			word_str;
 
+	typedef std::vector<const fts_tokenizer_word_t*,
+			    ut_allocator<const fts_tokenizer_word_t*> >
+		words_t;
+
 	DBUG_ENTER("i_s_fts_index_cache_fill_one_index");
 
 	fields = table->field;
@@ -3234,13 +3256,38 @@ i_s_fts_index_cache_fill_one_index(
 
 	int	ret = 0;
 
-	/* Go through each word in the index cache */
-	for (rbt_node = rbt_first(index_cache->words);
-	     rbt_node;
-	     rbt_node = rbt_next(index_cache->words, rbt_node)) {
-		fts_tokenizer_word_t* word;
+	/* The words are kept in shards, and the ones that are being
+	synced are separate from the current ones. List the words being
+	synced first, and all of them in collation order. */
+	words_t	words;
+
+	for (ulint i = 0; i < 2; i++) {
+		ib_rbt_t* const*	shards = i == 0
+			? index_cache->sync_words : index_cache->words;
 
-		word = rbt_value(fts_tokenizer_word_t, rbt_node);
+		for (ulint j = 0; j < FTS_NUM_AUX_INDEX; j++) {
+			const ib_rbt_node_t*	rbt_node;
+
+			if (shards[j] == NULL) {
+				continue;
+			}
+
+			for (rbt_node = rbt_first(shards[j]);
+			     rbt_node;
+			     rbt_node = rbt_next(shards[j], rbt_node)) {
+				words.push_back(rbt_value(
+					fts_tokenizer_word_t, rbt_node));
+			}
+		}
+	}
+
+	std::stable_sort(words.begin(), words.end(),
+			 i_s_fts_word_less(index_charset));
+
+	/* Go through each word in the index cache */
+	for (words_t::const_iterator it = words.begin();
+	     it != words.end(); ++it) {
+		const fts_tokenizer_word_t* word = *it;
 
 		/* Convert word from index charset to system_charset_info */
 		if (index_charset->cset != system_charset_info->cset) {
@@ -3260,13 +3307,13 @@ i_s_fts_index_cache_fill_one_index(
 
 		/* Decrypt the ilist, and display Dod ID and word position */
 		for (ulint i = 0; i < ib_vector_size(word->nodes); i++) {
-			fts_node_t*	node;
+			const fts_node_t*	node;
 			byte*		ptr;
 			ulint		decoded = 0;
 			doc_id_t	doc_id = 0;
 
-			node = static_cast<fts_node_t*> (ib_vector_get(
-				word->nodes, i));
+			node = static_cast<const fts_node_t*>(
+				ib_vector_get_const(word->nodes, i));
 
 			ptr = node->ilist;
 
@@ -3361,6 +3408,8 @@ i_s_fts_index_cache_fill(
 		* FTS_MAX_WORD_LEN_IN_CHAR;
 	conv_str.f_str = static_cast<byte*>(ut_malloc_nokey(conv_str.f_len));
 
+	rw_lock_s_lock(&cache->lock);
+
 	for (ulint i = 0; i < ib_vector_size(cache->indexes); i++) {
 		fts_index_cache_t*      index_cache;
 
@@ -3371,6 +3420,8 @@ i_s_fts_index_cache_fill(
 				 index_cache, thd, &conv_str, tables));
 	}
 
+	rw_lock_s_unlock(&cache->lock);
+
 	ut_free(conv_str.f_str);
 
 	dict_table_close(user_table, FALSE, FALSE);
@@ -3628,13 +3679,13 @@ i_s_fts_index_table_fill_one_fetch(
 
 		/* Decrypt the ilist, and display Dod ID and word position */
 		for (ulint i = 0; i < ib_vector_size(word->nodes); i++) {
-			fts_node_t*	node;
+			const fts_node_t*	node;
 			byte*		ptr;
 			ulint		decoded = 0;
 			doc_id_t	doc_id = 0;
 
-			node = static_cast<fts_node_t*> (ib_vector_get(
-				word->nodes, i));
+			node = static_cast<const fts_node_t*>(
+				ib_vector_get_const(word->nodes, i));
 
 			ptr = node->ilist;
 
@@ -9468,3 +9519,260 @@ UNIV_INTERN struct st_maria_plugin	i_s_innodb_sys_semaphore_waits =
 	STRUCT_FLD(version_info, INNODB_VERSION_STR),
         STRUCT_FLD(maturity, MariaDB_PLUGIN_MATURITY_STABLE),
 };
+
+#ifdef BTR_CUR_HASH_ADAPT
+/**  INNODB_ADAPTIVE_HASH_STATS  ***********************************/
+/* Fields of the dynamic table INFORMATION_SCHEMA.INNODB_ADAPTIVE_HASH_STATS */
+static ST_FIELD_INFO	innodb_adaptive_hash_stats_fields_info[] =
+{
+#define AHI_STATS_DATABASE_NAME		0
+	{STRUCT_FLD(field_name,		"DATABASE_NAME"),
+	 STRUCT_FLD(field_length,	192),
+	 STRUCT_FLD(field_type,		MYSQL_TYPE_STRING),
+	 STRUCT_FLD(value,		0),
+	 STRUCT_FLD(field_flags,	0),
+	 STRUCT_FLD(old_name,		""),
+	 STRUCT_FLD(open_method,	SKIP_OPEN_TABLE)},
+
+#define AHI_STATS_TABLE_NAME		1
+	{STRUCT_FLD(field_name,		"TABLE_NAME"),
+	 STRUCT_FLD(field_length,	192),
+	 STRUCT_FLD(field_type,		MYSQL_TYPE_STRING),
+	 STRUCT_FLD(value,		0),
+	 STRUCT_FLD(field_flags,	0),
+	 STRUCT_FLD(old_name,		""),
+	 STRUCT_FLD(open_method,	SKIP_OPEN_TABLE)},
+
+#define AHI_STATS_INDEX_NAME		2
+	{STRUCT_FLD(field_name,		"INDEX_NAME"),
+	 STRUCT_FLD(field_length,	192),
+	 STRUCT_FLD(field_type,		MYSQL_TYPE_STRING),
+	 STRUCT_FLD(value,		0),
+	 STRUCT_FLD(field_flags,	0),
+	 STRUCT_FLD(old_name,		""),
+	 STRUCT_FLD(open_method,	SKIP_OPEN_TABLE)},
+
+#define AHI_STATS_INDEX_ID		3
+	{STRUCT_FLD(field_name,		"INDEX_ID"),
+	 STRUCT_FLD(field_length,	MY_INT64_NUM_DECIMAL_DIGITS),
+	 STRUCT_FLD(field_type,		MYSQL_TYPE_LONGLONG),
+	 STRUCT_FLD(value,		0),
+	 STRUCT_FLD(field_flags,	MY_I_S_UNSIGNED),
+	 STRUCT_FLD(old_name,		""),
+	 STRUCT_FLD(open_method,	SKIP_OPEN_TABLE)},
+
+#define AHI_STATS_HASHED_PAGES		4
+	{STRUCT_FLD(field_name,		"HASHED_PAGES"),
+	 STRUCT_FLD(field_length,	MY_INT64_NUM_DECIMAL_DIGITS),
+	 STRUCT_FLD(field_type,		MYSQL_TYPE_LONGLONG),
+	 STRUCT_FLD(value,		0),
+	 STRUCT_FLD(field_flags,	MY_I_S_UNSIGNED),
+	 STRUCT_FLD(old_name,		""),
+	 STRUCT_FLD(open_method,	SKIP_OPEN_TABLE)},
+
+#define AHI_STATS_HASH_SEARCHES		5
+	{STRUCT_FLD(field_name,		"HASH_SEARCHES"),
+	 STRUCT_FLD(field_length,	MY_INT64_NUM_DECIMAL_DIGITS),
+	 STRUCT_FLD(field_type,		MYSQL_TYPE_LONGLONG),
+	 STRUCT_FLD(value,		0),
+	 STRUCT_FLD(field_flags,	MY_I_S_UNSIGNED),
+	 STRUCT_FLD(old_name,		""),
+	 STRUCT_FLD(open_method,	SKIP_OPEN_TABLE)},
+
+#define AHI_STATS_BTREE_SEARCHES	6
+	{STRUCT_FLD(field_name,		"BTREE_SEARCHES"),
+	 STRUCT_FLD(field_length,	MY_INT64_NUM_DECIMAL_DIGITS),
+	 STRUCT_FLD(field_type,		MYSQL_TYPE_LONGLONG),
+	 STRUCT_FLD(value,		0),
+	 STRUCT_FLD(field_flags,	MY_I_S_UNSIGNED),
+	 STRUCT_FLD(old_name,		""),
+	 STRUCT_FLD(open_method,	SKIP_OPEN_TABLE)},
+
+	END_OF_ST_FIELD_INFO
+};
+
+/** Populate information_schema.innodb_adaptive_hash_stats with the
+search counters of the indexes of a table.
+@param[in]	thd		thread
+@param[in]	table		table in the data dictionary cache
+@param[in,out]	table_to_fill	fill this table
+@return 0 on success */
+static
+int
+i_s_innodb_adaptive_hash_stats_fill_table(
+	THD*			thd,
+	const dict_table_t*	table,
+	TABLE*			table_to_fill)
+{
+	Field**	fields = table_to_fill->field;
+	char	db_utf8[MAX_DB_UTF8_LEN];
+	char	table_utf8[MAX_TABLE_UTF8_LEN];
+
+	DBUG_ENTER("i_s_innodb_adaptive_hash_stats_fill_table");
+
+	ut_ad(mutex_own(&dict_sys->mutex));
+
+	/* Skip the SYS_* tables, whose names contain no database name. */
+	if (!strchr(table->name.m_name, '/')) {
+		DBUG_RETURN(0);
+	}
+
+	dict_fs2utf8(table->name.m_name,
+		     db_utf8, sizeof(db_utf8),
+		     table_utf8, sizeof(table_utf8));
+
+	for (const dict_index_t* index = dict_table_get_first_index(table);
+	     index != NULL;
+	     index = dict_table_get_next_index(index)) {
+
+		const btr_search_t*	info = index->search_info;
+
+		/* The counters are read without any latch. The search
+		counters are sampled. */
+		ulint	hashed_pages = info->ref_count;
+		ulint	hash_searches = info->n_hash_searches
+			* BTR_SEARCH_SAMPLE;
+		ulint	btree_searches = info->n_btree_searches
+			* BTR_SEARCH_SAMPLE;
+
+		if (!hashed_pages && !hash_searches && !btree_searches) {
+			continue;
+		}
+
+		OK(field_store_string(fields[AHI_STATS_DATABASE_NAME],
+				      db_utf8));
+		OK(field_store_string(fields[AHI_STATS_TABLE_NAME],
+				      table_utf8));
+		OK(field_store_index_name(fields[AHI_STATS_INDEX_NAME],
+					  index->name));
+		OK(fields[AHI_STATS_INDEX_ID]->store(longlong(index->id),
+						     true));
+		OK(fields[AHI_STATS_HASHED_PAGES]->store(hashed_pages, true));
+		OK(fields[AHI_STATS_HASH_SEARCHES]->store(hash_searches,
+							  true));
+		OK(fields[AHI_STATS_BTREE_SEARCHES]->store(btree_searches,
+							   true));
+		OK(schema_table_store_record(thd, table_to_fill));
+	}
+
+	DBUG_RETURN(0);
+}
+
+/*******************************************************************//**
+Go through the tables in the data dictionary cache, and fill the
+information_schema.innodb_adaptive_hash_stats table with the adaptive
+hash index search counters of their indexes
+@return 0 on success */
+static
+int
+i_s_innodb_adaptive_hash_stats_fill(
+/*================================*/
+	THD*		thd,	/*!< in: thread */
+	TABLE_LIST*	tables,	/*!< in/out: tables to fill */
+	Item*		)	/*!< in: condition (not used) */
+{
+	int	status = 0;
+
+	DBUG_ENTER("i_s_innodb_adaptive_hash_stats_fill");
+	RETURN_IF_INNODB_NOT_STARTED(tables->schema_table_name.str);
+
+	/* deny access to user without PROCESS_ACL privilege */
+	if (check_global_access(thd, PROCESS_ACL)) {
+		DBUG_RETURN(0);
+	}
+
+	mutex_enter(&dict_sys->mutex);
+
+	for (const dict_table_t* table
+		     = UT_LIST_GET_FIRST(dict_sys->table_LRU);
+	     table != NULL && status == 0;
+	     table = UT_LIST_GET_NEXT(table_LRU, table)) {
+
+		status = i_s_innodb_adaptive_hash_stats_fill_table(
+			thd, table, tables->table);
+	}
+
+	for (const dict_table_t* table
+		     = UT_LIST_GET_FIRST(dict_sys->table_non_LRU);
+	     table != NULL && status == 0;
+	     table = UT_LIST_GET_NEXT(table_LRU, table)) {
+
+		status = i_s_innodb_adaptive_hash_stats_fill_table(
+			thd, table, tables->table);
+	}
+
+	mutex_exit(&dict_sys->mutex);
+
+	DBUG_RETURN(status);
+}
+
+/*******************************************************************//**
+Bind the dynamic table INFORMATION_SCHEMA.INNODB_ADAPTIVE_HASH_STATS
+@return 0 on success */
+static
+int
+innodb_adaptive_hash_stats_init(
+/*============================*/
+	void*	p)	/*!< in/out: table schema object */
+{
+	ST_SCHEMA_TABLE*	schema;
+
+	DBUG_ENTER("innodb_adaptive_hash_stats_init");
+
+	schema = (ST_SCHEMA_TABLE*) p;
+
+	schema->fields_info = innodb_adaptive_hash_stats_fields_info;
+	schema->fill_table = i_s_innodb_adaptive_hash_stats_fill;
+
+	DBUG_RETURN(0);
+}
+
+UNIV_INTERN struct st_maria_plugin	i_s_innodb_adaptive_hash_stats =
+{
+	/* the plugin type (a MYSQL_XXX_PLUGIN value) */
+	/* int */
+	STRUCT_FLD(type, MYSQL_INFORMATION_SCHEMA_PLUGIN),
+
+	/* pointer to type-specific plugin descriptor */
+	/* void* */
+	STRUCT_FLD(info, &i_s_info),
+
+	/* plugin name */
+	/* const char* */
+	STRUCT_FLD(name, "INNODB_ADAPTIVE_HASH_STATS"),
+
+	/* plugin author (for SHOW PLUGINS) */
+	/* const char* */
+	STRUCT_FLD(author, maria_plugin_author),
+
+	/* general descriptive text (for SHOW PLUGINS) */
+	/* const char* */
+	STRUCT_FLD(descr, "InnoDB adaptive hash index searches per index"),
+
+	/* the plugin license (PLUGIN_LICENSE_XXX) */
+	/* int */
+	STRUCT_FLD(license, PLUGIN_LICENSE_GPL),
+
+	/* the function to invoke when plugin is loaded */
+	/* int (*)(void*); */
+	STRUCT_FLD(init, innodb_adaptive_hash_stats_init),
+
+	/* the function to invoke when plugin is unloaded */
+	/* int (*)(void*); */
+	STRUCT_FLD(deinit, i_s_common_deinit),
+
+	/* plugin version (for SHOW PLUGINS) */
+	/* unsigned int */
+	STRUCT_FLD(version, INNODB_VERSION_SHORT),
+
+	/* struct st_mysql_show_var* */
+	STRUCT_FLD(status_vars, NULL),
+
+	/* struct st_mysql_sys_var** */
+	STRUCT_FLD(system_vars, NULL),
+
+        /* Maria extension */
+	STRUCT_FLD(version_info, INNODB_VERSION_STR),
+        STRUCT_FLD(maturity, MariaDB_PLUGIN_MATURITY_STABLE),
+};
+#endif /* BTR_CUR_HASH_ADAPT */
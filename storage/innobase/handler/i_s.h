@@ -64,6 +64,9 @@ extern struct st_maria_plugin	i_s_innodb_sys_virtual;
 extern struct st_maria_plugin	i_s_innodb_tablespaces_encryption;
 extern struct st_maria_plugin	i_s_innodb_tablespaces_scrubbing;
 extern struct st_maria_plugin	i_s_innodb_sys_semaphore_waits;
+#ifdef BTR_CUR_HASH_ADAPT
+extern struct st_maria_plugin	i_s_innodb_adaptive_hash_stats;
+#endif /* BTR_CUR_HASH_ADAPT */
 
 /** maximum number of buffer page info we would cache. */
 #define MAX_BUF_INFO_CACHED		10000
@@ -32,6 +32,7 @@ Created 10/16/1994 Heikki Tuuri
 #include "page0cur.h"
 #include "btr0types.h"
 #include "gis0type.h"
+#include "ut0counter.h"
 
 /** Mode flags for btr_cur operations; these can be ORed */
 enum {
@@ -951,6 +952,11 @@ struct btr_cur_t {
 					rows in range, we store in this array
 					information of the path through
 					the tree */
+	ulint		parent_page_no;	/*!< page number of the node pointer
+					page through which
+					btr_cur_search_to_nth_level() or
+					btr_cur_open_at_index_side() last
+					reached a leaf page, or FIL_NULL */
 	rtr_info_t*	rtr_info;	/*!< rtree search info */
 	btr_cur_t():thr(NULL), rtr_info(NULL) {}
 					/* default values */
@@ -1006,8 +1012,9 @@ earlier version of the row.  In rollback we are not allowed to free an
 inherited external field. */
 #define BTR_EXTERN_INHERITED_FLAG	64U
 
-/** Number of searches down the B-tree in btr_cur_search_to_nth_level(). */
-extern ulint	btr_cur_n_non_sea;
+/** Number of searches down the B-tree in btr_cur_search_to_nth_level().
+Sharded, so that concurrent searches do not contend on one cache line. */
+extern ib_counter_t<ulint, 64>	btr_cur_n_non_sea;
 /** Old value of btr_cur_n_non_sea.  Copied by
 srv_refresh_innodb_monitor_stats().  Referenced by
 srv_printf_innodb_monitor(). */
@@ -1015,7 +1022,7 @@ extern ulint	btr_cur_n_non_sea_old;
 #ifdef BTR_CUR_HASH_ADAPT
 /** Number of successful adaptive hash index lookups in
 btr_cur_search_to_nth_level(). */
-extern ulint	btr_cur_n_sea;
+extern ib_counter_t<ulint, 64>	btr_cur_n_sea;
 /** Old value of btr_cur_n_sea.  Copied by
 srv_refresh_innodb_monitor_stats().  Referenced by
 srv_printf_innodb_monitor(). */
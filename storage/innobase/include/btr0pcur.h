@@ -352,6 +352,21 @@ btr_pcur_move_to_next_page(
 	btr_pcur_t*	cursor,	/*!< in: persistent cursor; must be on the
 				last record of the current page */
 	mtr_t*		mtr);	/*!< in: mtr */
+
+/** Issue asynchronous reads for the leaf pages that follow the current
+page of an ascending index scan, as named by the node pointers of the
+parent page. Because the cursor is holding a latch on the child page,
+the parent page is only latched if that is possible without waiting.
+@param[in]	cursor	persistent cursor, positioned on a leaf page
+@param[in,out]	parent	page number of the parent page, or FIL_NULL to
+			use the page that the last search of the cursor
+			passed through; set to the page where the node pointer
+			to the current page was found, or to FIL_NULL
+@param[in]	n_pages	number of pages to read ahead
+@return the read-ahead page on whose access this function should be
+invoked again, or FIL_NULL */
+ulint
+btr_pcur_read_ahead(const btr_pcur_t* cursor, ulint* parent, ulint n_pages);
 #ifdef UNIV_DEBUG
 /*********************************************************//**
 Returns the btr cursor component of a persistent cursor.
@@ -35,6 +35,7 @@ Created 2/17/1996 Heikki Tuuri
 #include "mtr0mtr.h"
 #ifdef BTR_CUR_HASH_ADAPT
 #include "ha0ha.h"
+#include "ut0counter.h"
 
 /** Creates and initializes the adaptive search system at a database start.
 @param[in]	hash_size	hash table size. */
@@ -244,6 +245,20 @@ btr_search_get_info(dict_index_t* index)
 }
 #endif /* BTR_CUR_ADAPT */
 
+#ifdef BTR_CUR_HASH_ADAPT
+/** One in this many searches updates the per-index search counters
+of btr_search_t */
+#define BTR_SEARCH_SAMPLE	32
+
+/** @return whether a search updates the per-index search counters */
+inline
+bool
+btr_search_sampled()
+{
+	return(!(counter_indexer_t<>::get_rnd_index() % BTR_SEARCH_SAMPLE));
+}
+#endif /* BTR_CUR_HASH_ADAPT */
+
 /** The search info struct in an index */
 struct btr_search_t{
 	/* @{ The following fields are not protected by any latch.
@@ -295,6 +310,15 @@ struct btr_search_t{
 				far */
 	ulint	n_searches;	/*!< number of searches */
 #endif /* UNIV_SEARCH_PERF_STAT */
+	/* @{ Per-index counters, not protected by any latch and thus
+	not exact; reported in INFORMATION_SCHEMA.INNODB_ADAPTIVE_HASH_STATS.
+	Only one in BTR_SEARCH_SAMPLE searches is counted, so that
+	concurrent searches of an index seldom write to this struct. */
+	ulint	n_hash_searches;/*!< sampled number of searches that
+				succeeded using the adaptive hash index */
+	ulint	n_btree_searches;/*!< sampled number of searches that
+				had to descend the B-tree */
+	/* @} */
 #endif /* BTR_CUR_HASH_ADAPT */
 #ifdef UNIV_DEBUG
 	ulint	magic_n;	/*!< magic number @see BTR_SEARCH_MAGIC_N */
@@ -90,6 +90,8 @@ struct fil_addr_t;
 					buffer pool watches */
 #define MAX_PAGE_HASH_LOCKS	1024	/*!< The maximum number of
 					page_hash locks */
+#define BUF_YOUNG_QUEUE_SIZE	256	/*!< Number of slots in
+					buf_pool_t::young_queue */
 
 extern	buf_pool_t*	buf_pool_ptr;	/*!< The buffer pools
 					of the database */
@@ -503,13 +505,15 @@ Suitable for using when holding the lock_sys_t::mutex.
 @param[in]	file	file name
 @param[in]	line	line where called
 @param[in]	mtr	mini-transaction
+@param[in]	possibly_freed	whether the page may have been freed
 @return pointer to a page or NULL */
 buf_block_t*
 buf_page_try_get_func(
 	const page_id_t&	page_id,
 	const char*		file,
 	unsigned		line,
-	mtr_t*			mtr);
+	mtr_t*			mtr,
+	bool			possibly_freed = false);
 
 /** Tries to get a page.
 If the page is not in the buffer pool it is not loaded. Suitable for using
@@ -597,6 +601,15 @@ buf_page_make_young(
 /*================*/
 	buf_page_t*	bpage);	/*!< in: buffer block of a file page */
 
+/** Request a page to be moved to the start of the buffer pool LRU list
+without acquiring buf_pool->mutex. The move is carried out by
+buf_LRU_make_queued_young() before the next LRU scan or LRU flush batch
+of the buffer pool instance; if the queue overflows before that,
+the oldest requests are forgotten.
+@param[in]	bpage	buffer-fixed or latched file page */
+void
+buf_page_make_young_deferred(const buf_page_t* bpage);
+
 /** Returns TRUE if the page can be found in the buffer pool hash table.
 NOTE that it is possible that the page is not yet read from disk,
 though.
@@ -1663,6 +1676,18 @@ class buf_page_t {
 					and buf_pool->flush_list_mutex. Hence
 					reads can happen while holding
 					any one of the two mutexes */
+	unsigned	write_time;	/*!< ut_time_ms() when the page
+					was last written to the data file,
+					or 0. Written under buf_pool->mutex
+					in buf_flush_write_complete(), and
+					read under buf_pool->flush_list_mutex
+					when the page is added to the flush
+					list; a stale value only makes the
+					write_heat inexact */
+	byte		write_heat;	/*!< how many times the page was
+					modified again soon after being
+					written, halved whenever it was not.
+					Protected like oldest_modification */
 	/* @} */
 	/** @name LRU replacement algorithm fields
 	These fields are protected by buf_pool->mutex only (not
@@ -2214,6 +2239,28 @@ struct buf_pool_t{
 					buf_pool->mutex */
 	/* @} */
 
+	/** @name Deferred LRU movement */
+	/* @{ */
+
+	ib_uint64_t	young_queue[BUF_YOUNG_QUEUE_SIZE];
+					/*!< pages to move to the start of
+					the LRU list, as page_id_t packed by
+					buf_page_make_young_deferred(), or 0
+					for an empty slot; written without
+					holding any mutex, emptied by
+					buf_LRU_make_queued_young() under
+					buf_pool->mutex */
+	ulint		young_queue_tail;
+					/*!< number of requests ever appended
+					to young_queue; updated atomically */
+	ulint		young_queue_n;
+					/*!< number of nonempty slots in
+					young_queue; updated atomically,
+					after the slot has been written or
+					emptied, so it can briefly lag
+					behind (or wrap below 0) */
+	/* @} */
+
 	/** @name LRU replacement algorithm fields */
 	/* @{ */
 
@@ -100,14 +100,14 @@ written to the dblwr buffer on disk. */
 void
 buf_dblwr_sync_datafiles();
 
-/********************************************************************//**
-Flushes possible buffered writes from the doublewrite memory buffer to disk,
+/** Flushes possible buffered writes from the doublewrite memory buffer to disk,
 and also wakes up the aio thread if simulated aio is used. It is very
 important to call this function after a batch of writes has been posted,
 and also when we may have to wait for a page latch! Otherwise a deadlock
-of threads can occur. */
+of threads can occur.
+@param[in]	buf_pool	buffer pool instance whose batch to write */
 void
-buf_dblwr_flush_buffered_writes();
+buf_dblwr_flush_buffered_writes(const buf_pool_t* buf_pool);
 
 /********************************************************************//**
 Writes a page to the doublewrite buffer on disk, sync it, then write
@@ -123,6 +123,33 @@ buf_dblwr_write_single_page(
 	buf_page_t*	bpage,	/*!< in: buffer block to write */
 	bool		sync);	/*!< in: true if sync IO requested */
 
+/** A doublewrite file that holds the batch flushes of one buffer pool
+instance when innodb_doublewrite_file_pages > 0 */
+struct buf_dblwr_file_t{
+	ib_mutex_t	mutex;	/*!< mutex protecting the first_free
+				field and write_buf */
+	pfs_os_file_t	handle;	/*!< the doublewrite file */
+	char*		path;	/*!< name of the doublewrite file */
+	ulint		first_free;/*!< first free position in write_buf
+				measured in units of UNIV_PAGE_SIZE */
+	ulint		b_reserved;/*!< number of slots currently reserved
+				for batch flush. */
+	os_event_t	b_event;/*!< event where threads wait for a
+				batch flush to end;
+				os_event_set() and os_event_reset()
+				are protected by buf_dblwr_file_t::mutex */
+	bool		batch_running;/*!< set to TRUE if currently a batch
+				is being written from this file */
+	byte*		write_buf;/*!< write buffer of
+				srv_doublewrite_file_pages pages, aligned
+				to UNIV_PAGE_SIZE */
+	byte*		write_buf_unaligned;/*!< pointer to write_buf,
+				but unaligned */
+	buf_page_t**	buf_block_arr;/*!< array to store pointers to
+				the buffer blocks which have been
+				cached to write_buf */
+};
+
 /** Doublewrite control struct */
 struct buf_dblwr_t{
 	ib_mutex_t	mutex;	/*!< mutex protecting the first_free
@@ -157,6 +184,10 @@ struct buf_dblwr_t{
 	buf_page_t**	buf_block_arr;/*!< array to store pointers to
 				the buffer blocks which have been
 				cached to write_buf */
+	buf_dblwr_file_t* files;/*!< srv_buf_pool_instances doublewrite
+				files for batch flushes, indexed by
+				buf_pool_t::instance_no; NULL if batch
+				flushes use the system tablespace */
 };
 
 #endif
@@ -337,6 +337,14 @@ void
 buf_flush_request_force(
 	lsn_t	lsn_limit);
 
+/** Set the oldest modification LSN that the adaptive flushing of the
+page cleaner should reach in its next round.
+@param[in]	lsn	target for buf_pool_get_oldest_modification(),
+or 0 if the page cleaner may decide on its own */
+void
+buf_flush_set_pace_lsn(
+	lsn_t	lsn);
+
 /** We use FlushObserver to track flushing of non-redo logged pages in bulk
 create index(BtrBulk.cc).Since we disable redo logging during a index build,
 we need to make sure that all dirty pages modifed by the index build are
@@ -179,6 +179,13 @@ void
 buf_LRU_make_block_young(
 /*=====================*/
 	buf_page_t*	bpage);	/*!< in: control block */
+
+/** Move the pages requested by buf_page_make_young_deferred() to the
+start of the LRU list, if they are still in the buffer pool and old
+enough to be made young.
+@param[in,out]	buf_pool	buffer pool instance */
+void
+buf_LRU_make_queued_young(buf_pool_t* buf_pool);
 /**********************************************************************//**
 Updates buf_pool->LRU_old_ratio.
 @return updated old_pct */
@@ -257,6 +264,22 @@ least this many milliseconds ago.  Not protected by any mutex or latch. */
 extern uint	buf_LRU_old_threshold_ms;
 /* @} */
 
+/** Alternatives for innodb_unzip_lru_policy */
+enum buf_LRU_unzip_policy_t {
+	/** choose between unzip_LRU and LRU based on the ratio of
+	I/O and page_zip_decompress() operations */
+	BUF_LRU_UNZIP_ADAPTIVE,
+	/** evict the uncompressed frames of compressed pages first,
+	keeping the compressed pages in the buffer pool */
+	BUF_LRU_UNZIP_KEEP_COMPRESSED,
+	/** never prefer unzip_LRU; evict whole blocks from the LRU list */
+	BUF_LRU_UNZIP_KEEP_UNCOMPRESSED
+};
+
+/** innodb_unzip_lru_policy; enum buf_LRU_unzip_policy_t.
+Not protected by any mutex. */
+extern ulong	buf_LRU_unzip_policy;
+
 /** @brief Statistics for selecting the LRU list for eviction.
 
 These statistics are not 'of' LRU but 'for' LRU.  We keep count of I/O
@@ -115,6 +115,26 @@ buf_read_ahead_linear(
 	const page_size_t&	page_size,
 	ibool			inside_ibuf);
 
+/** Maximum value of innodb_range_read_ahead */
+#define BUF_READ_AHEAD_RANGE_MAX	256
+
+/** Issue asynchronous read requests for index leaf pages that a range scan
+is about to access.
+NOTE: the calling thread may own latches on pages: to avoid deadlocks this
+function must be written such that it cannot end up waiting for these
+latches!
+@param[in]	space_id	tablespace identifier
+@param[in]	page_size	page size
+@param[in]	page_nos	page numbers, in the order of access
+@param[in]	n		number of elements in page_nos
+@return number of page read requests issued */
+ulint
+buf_read_ahead_range(
+	ulint			space_id,
+	const page_size_t&	page_size,
+	const ulint*		page_nos,
+	ulint			n);
+
 /********************************************************************//**
 Issues read requests for pages which the ibuf module wants to read in, in
 order to contract the insert buffer tree. Technically, this function is like
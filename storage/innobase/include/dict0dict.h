@@ -1809,6 +1809,13 @@ bool dict_set_corrupted_by_space(const fil_space_t* space);
 /** Flag a table encrypted in the data dictionary cache. */
 void dict_set_encrypted_by_space(const fil_space_t* space);
 
+/** Write SYS_INDEXES.TYPE of a secondary index with or without
+DICT_CORRUPT, without changing the data dictionary cache.
+@param[in]	index		secondary index
+@param[in]	corrupted	whether to set DICT_CORRUPT */
+void
+dict_index_write_corrupted(const dict_index_t* index, bool corrupted);
+
 /** Sets merge_threshold in the SYS_INDEXES
 @param[in,out]	index		index
 @param[in]	merge_threshold	value to set */
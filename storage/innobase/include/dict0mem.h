@@ -31,6 +31,7 @@ Created 1/8/1996 Heikki Tuuri
 #include "univ.i"
 #include "dict0types.h"
 #include "data0type.h"
+#include "data0types.h"
 #include "mem0mem.h"
 #include "row0types.h"
 #include "rem0types.h"
@@ -844,6 +845,16 @@ const char innobase_index_reserve_name[] = "GEN_CLUST_INDEX";
 to start with. */
 #define OFFS_IN_REC_NORMAL_SIZE		100
 
+/** Comparator of the leading fixed-length key fields of a data tuple
+and a ROW_FORMAT=COMPACT, DYNAMIC or COMPRESSED record of an index;
+see cmp_index_init() */
+typedef int (*dict_cmp_fixed_t)(
+	const dtuple_t*		dtuple,
+	const rec_t*		rec,
+	const dict_index_t*	index,
+	ulint			n_cmp,
+	ulint*			matched_fields);
+
 /** Data structure for an index.  Most fields will be
 initialized to 0, NULL or FALSE in dict_mem_index_create(). */
 struct dict_index_t{
@@ -899,6 +910,10 @@ struct dict_index_t{
 	/** magic value signalling that n_core_null_bytes was not
 	initialized yet */
 	static const unsigned NO_CORE_NULL_BYTES = 0xff;
+	/** number of leading fields that are NOT NULL, of fixed length
+	and comparable with memcmp() in ROW_FORMAT!=REDUNDANT records,
+	or 0 if cmp_fixed is not used */
+	unsigned	n_cmp_fixed:10;
 	/** The clustered index ID of the hard-coded SYS_INDEXES table. */
 	static const unsigned DICT_INDEXES_ID = 3;
 	unsigned	cached:1;/*!< TRUE if the index object is in the
@@ -926,6 +941,10 @@ struct dict_index_t{
 # define DICT_INDEX_MAGIC_N	76789786
 #endif
 	dict_field_t*	fields;	/*!< array of field descriptions */
+	dict_cmp_fixed_t cmp_fixed;
+				/*!< comparator of the n_cmp_fixed
+				leading fields, chosen by
+				cmp_index_init(), or NULL */
 	st_mysql_ftparser*
 			parser;	/*!< fulltext parser plugin */
 	bool		has_new_v_col;
@@ -1712,6 +1731,11 @@ struct dict_table_t {
 	/*!< set of foreign key constraints which refer to this table */
 	dict_foreign_set			referenced_set;
 
+	/** Percentage of each ROW_FORMAT=COMPRESSED page to keep free
+	for the modification log (table option ZIP_LOG_PCT), or 0.
+	Copied from the .frm file when the table is opened. */
+	ulint					zip_log_pct;
+
 	/** Statistics for query optimization. @{ */
 
 	/** Creation state of 'stats_latch'. */
@@ -1885,7 +1909,10 @@ struct dict_table_t {
 
 	/** Count of the number of record locks on this table. We use this to
 	determine whether we can evict the table from the dictionary cache.
-	It is protected by lock_sys.mutex. */
+	It is incremented with my_atomic_addlint() under a lock_sys
+	rec_hash shard latch, because record locks on pages in different
+	shards can be created concurrently. It is decremented under
+	lock_sys.mutex, which excludes all the shard latches. */
 	ulint					n_rec_locks;
 
 #ifndef DBUG_ASSERT_EXISTS
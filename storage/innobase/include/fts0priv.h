@@ -74,6 +74,10 @@ typedef enum fts_table_state_enum fts_table_state_t;
 /** The next doc id */
 #define FTS_SYNCED_DOC_ID		"synced_doc_id"
 
+/** The synced_doc_id before a SYNC whose helper threads may commit
+words before the SYNC itself commits */
+#define FTS_SYNC_PENDING		"sync_pending"
+
 /** The last word that was OPTIMIZED */
 #define FTS_LAST_OPTIMIZED_WORD		"last_optimized_word"
 
@@ -438,7 +442,10 @@ fts_cache_find_word(
 	const fts_index_cache_t*
 			index_cache,	/*!< in: cache to search */
 	const fts_string_t*
-			text)		/*!< in: word to search for */
+			text,		/*!< in: word to search for */
+	bool		syncing)	/*!< in: whether to search the
+					words that are being synced
+					instead of the current ones */
 	MY_ATTRIBUTE((warn_unused_result));
 
 /******************************************************************//**
@@ -65,8 +65,19 @@ per index cache of words etc. */
 struct fts_index_cache_t {
 	dict_index_t*	index;		/*!< The FTS index instance */
 
-	ib_rbt_t*	words;		/*!< Nodes; indexed by fts_string_t*,
-					cells are fts_tokenizer_word_t*.*/
+	ib_rbt_t*	words[FTS_NUM_AUX_INDEX];
+					/*!< Nodes; indexed by fts_string_t*,
+					cells are fts_tokenizer_word_t*.
+					The words are sharded the same way
+					as the auxiliary INDEX tables, see
+					fts_select_index() */
+
+	ib_rbt_t*	sync_words[FTS_NUM_AUX_INDEX];
+					/*!< The shards of words that are
+					being written by a SYNC, or NULL.
+					They are read-only until the SYNC
+					completes, and new documents are
+					added to words meanwhile */
 
 	ib_vector_t*	doc_stats;	/*!< Array of the fts_doc_stats_t
 					contained in the memory buffer.
@@ -126,8 +137,18 @@ struct fts_sync_t {
 					set the upper_limit field */
 	ib_time_t	start_time;	/*!< SYNC start time */
 	bool		in_progress;	/*!< flag whether sync is in progress.*/
-	bool		unlock_cache;	/*!< flag whether unlock cache when
-					write fts node */
+	mem_heap_t*	heap;		/*!< Heap of the cache generation
+					that is being synced, that is, of
+					fts_index_cache_t::sync_words and
+					deleted_doc_ids, or NULL */
+	ib_vector_t*	deleted_doc_ids;/*!< Deleted doc ids of the cache
+					generation that is being synced,
+					each element is of type fts_update_t */
+	doc_id_t	sync_doc_id;	/*!< max_doc_id of the cache
+					generation that is being synced */
+	ulint		sync_size;	/*!< fts_cache_t::total_size of the
+					cache generation that is being
+					synced */
 	os_event_t	event;		/*!< sync finish event;
 					only os_event_set() and os_event_wait()
 					are used */
@@ -219,7 +240,6 @@ struct fts_node_t {
 	ulint		ilist_size_alloc;
 					/*!< Allocated size of ilist in
 					bytes */
-	bool		synced;		/*!< flag whether the node is synced */
 };
 
 /** A tokenizer word. Contains information about one word. */
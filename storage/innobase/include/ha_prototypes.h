@@ -325,6 +325,14 @@ const char*
 thd_innodb_tmpdir(
 	THD*	thd);
 
+/** Get the value of innodb_sort_merge_threads.
+@param[in]	thd	thread handle, or NULL to query
+			the global innodb_sort_merge_threads
+@return number of threads for merging sorted index entries */
+ulong
+thd_sort_merge_threads(
+	THD*	thd);
+
 /**********************************************************************//**
 Get the current setting of the table_cache_size global parameter. We do
 a dirty read because for one there is no synchronization object and
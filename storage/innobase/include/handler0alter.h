@@ -21,18 +21,6 @@ this program; if not, write to the Free Software Foundation, Inc.,
 Smart ALTER TABLE
 *******************************************************/
 
-/*************************************************************//**
-Copies an InnoDB record to table->record[0]. */
-void
-innobase_rec_to_mysql(
-/*==================*/
-	struct TABLE*		table,	/*!< in/out: MySQL table */
-	const rec_t*		rec,	/*!< in: record */
-	const dict_index_t*	index,	/*!< in: index */
-	const ulint*		offsets)/*!< in: rec_get_offsets(
-					rec, index, ...) */
-	MY_ATTRIBUTE((nonnull));
-
 /*************************************************************//**
 Copies an InnoDB index entry to table->record[0]. */
 void
@@ -875,6 +875,9 @@ struct lock_op_t{
 
 typedef ib_mutex_t LockMutex;
 
+/** Number of latches protecting the cells of lock_sys.rec_hash */
+#define LOCK_REC_HASH_N_SHARDS	16
+
 /** The lock system struct */
 class lock_sys_t
 {
@@ -891,6 +894,19 @@ class lock_sys_t
 	hash_table_t*	prdt_page_hash;		/*!< hash table of the page
 						lock */
 
+	/** Latch on a subset of the rec_hash cells. A record lock
+	request that does not have to wait is granted while holding
+	only the shard latch of the page's hash cell. Anything else
+	acquires the mutex and all shards, see lock_mutex_enter(). */
+	struct rec_hash_shard_t {
+		MY_ALIGNED(CACHE_LINE_SIZE)
+		LockMutex	mutex;		/*!< the shard latch */
+	};
+
+	/** Latches on the cells of rec_hash, addressed by
+	cell number modulo LOCK_REC_HASH_N_SHARDS */
+	rec_hash_shard_t rec_hash_shards[LOCK_REC_HASH_N_SHARDS];
+
 	MY_ALIGNED(CACHE_LINE_SIZE)
 	LockMutex	wait_mutex;		/*!< Mutex protecting the
 						next two fields */
@@ -950,6 +966,51 @@ class lock_sys_t
 
   /** Closes the lock system at database shutdown. */
   void close();
+
+
+  /**
+    Get the latch protecting a cell of rec_hash.
+
+    @param[in] cell rec_hash cell number, see lock_rec_hash()
+    @return the shard latch
+  */
+  LockMutex* rec_hash_shard(ulint cell)
+  {
+    return &rec_hash_shards[cell % LOCK_REC_HASH_N_SHARDS].mutex;
+  }
+
+
+  /**
+    Latch the rec_hash cell of a page, for granting a record lock
+    without acquiring the lock_sys.mutex.
+
+    @param[in] block buffer block
+    @return the acquired shard latch
+  */
+  LockMutex* rec_hash_shard_enter(const buf_block_t* block);
+
+
+  /** Acquire all rec_hash shard latches, after lock_sys.mutex. */
+  void rec_hash_shards_enter();
+
+
+  /** Release all rec_hash shard latches, before lock_sys.mutex. */
+  void rec_hash_shards_exit();
+
+#ifdef UNIV_DEBUG
+  /**
+    Check if the caller may access a cell of a lock hash table.
+
+    @param[in] hash lock hash table
+    @param[in] cell cell number
+    @return whether the lock_sys.mutex or the shard latch is held
+  */
+  bool hash_cell_own(const hash_table_t* hash, ulint cell)
+  {
+    return mutex.is_owned()
+      || (hash == rec_hash && rec_hash_shard(cell)->is_owned());
+  }
+#endif /* UNIV_DEBUG */
 };
 
 /*********************************************************************//**
@@ -1065,20 +1126,25 @@ lock_rec_free_all_from_discard_page(
 /** The lock system */
 extern lock_sys_t lock_sys;
 
-/** Test if lock_sys.mutex can be acquired without waiting. */
+/** Test if lock_sys.mutex can be acquired without waiting.
+If it can, acquire it and the rec_hash shard latches.
+@return 0 if the latches were acquired */
 #define lock_mutex_enter_nowait() 		\
-	(lock_sys.mutex.trylock(__FILE__, __LINE__))
+	(lock_sys.mutex.trylock(__FILE__, __LINE__)	\
+	 || (lock_sys.rec_hash_shards_enter(), 0))
 
 /** Test if lock_sys.mutex is owned. */
 #define lock_mutex_own() (lock_sys.mutex.is_owned())
 
-/** Acquire the lock_sys.mutex. */
+/** Acquire the lock_sys.mutex and all rec_hash shard latches. */
 #define lock_mutex_enter() do {			\
 	mutex_enter(&lock_sys.mutex);		\
+	lock_sys.rec_hash_shards_enter();	\
 } while (0)
 
-/** Release the lock_sys.mutex. */
+/** Release the lock_sys.mutex and all rec_hash shard latches. */
 #define lock_mutex_exit() do {			\
+	lock_sys.rec_hash_shards_exit();	\
 	lock_sys.mutex.exit();			\
 } while (0)
 
@@ -575,6 +575,23 @@ lock_get_type_low(
 /*==============*/
 	const lock_t*	lock);	/*!< in: lock */
 
+#ifdef UNIV_DEBUG
+/** Check if the caller may access the lock queue of a page.
+@param[in]	hash	lock hash table
+@param[in]	block	buffer block
+@return whether lock_sys.mutex or the rec_hash shard latch is held */
+UNIV_INLINE
+bool
+lock_rec_queue_own(const hash_table_t* hash, const buf_block_t* block);
+
+/** Check if the caller may access the lock queue of a record lock.
+@param[in]	lock	record lock
+@return whether lock_sys.mutex or the rec_hash shard latch is held */
+UNIV_INLINE
+bool
+lock_rec_queue_own(const lock_t* lock);
+#endif /* UNIV_DEBUG */
+
 /*********************************************************************//**
 Gets the previous record lock set on a record.
 @return previous lock on the same record, NULL if none exists */
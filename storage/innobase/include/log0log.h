@@ -109,6 +109,32 @@ log_write_low(
 /*==========*/
 	const byte*	str,		/*!< in: string */
 	ulint		str_len);	/*!< in: string length */
+/** Reserve space in the log buffer for a string that will be copied by
+log_write_reserved() after log_sys->mutex has been released.
+The log must be closed with log_close, and the reservation must be
+completed with log_write_reserved_complete().
+@param[in]	len	length of the data to be written
+@return byte offset of the reserved area in log_sys->buf */
+ulint
+log_reserve_for_copy(
+	ulint	len);
+/** Copy a part of a string to an area reserved by log_reserve_for_copy(),
+skipping the log block headers and trailers. This does not require
+log_sys->mutex.
+@param[in,out]	buf	log_sys->buf at the time of the reservation
+@param[in,out]	offset	byte offset in buf; advanced past the copied data
+@param[in]	str	string
+@param[in]	len	string length */
+void
+log_write_reserved(
+	byte*		buf,
+	ulint*		offset,
+	const byte*	str,
+	ulint		len);
+/** Note that all data for a log_reserve_for_copy() area has been copied. */
+UNIV_INLINE
+void
+log_write_reserved_complete();
 /************************************************************//**
 Closes the log.
 @return lsn */
@@ -642,6 +668,17 @@ struct log_t{
 	/** the redo log */
 	log_group_t			log;
 
+	char		pad5[CACHE_LINE_SIZE];/*!< Padding */
+	ulint		n_pending_copies;/*!< number of areas reserved with
+					log_reserve_for_copy() whose contents
+					have not been copied yet; must be 0
+					before the log buffer contents may be
+					written, switched or moved. Accessed
+					with my_atomic_loadlint() and friends;
+					incremented while holding
+					log_sys->mutex */
+	char		pad6[CACHE_LINE_SIZE];/*!< Padding */
+
 	/** The fields involved in the log buffer flush @{ */
 
 	ulint		buf_next_to_write;/*!< first offset in the log buffer
@@ -796,6 +833,19 @@ extern os_event_t	log_scrub_event;
 /** Whether log_scrub_thread is active */
 extern bool		log_scrub_thread_active;
 
+/** Event to wake up log_checkpointer_thread */
+extern os_event_t	log_checkpointer_event;
+/** Whether log_checkpointer_thread is active */
+extern bool		log_checkpointer_thread_active;
+
+/** Background thread that writes checkpoints and tells the page cleaner
+how far the oldest modification has to advance, so that user threads do
+not have to do either in log_free_check().
+@return this function does not return, it calls os_thread_exit() */
+extern "C"
+os_thread_ret_t
+DECLARE_THREAD(log_checkpointer_thread)(void*);
+
 #include "log0log.ic"
 
 #endif
@@ -36,6 +36,7 @@ Created 9/20/1997 Heikki Tuuri
 #include "ut0new.h"
 
 #include <list>
+#include <map>
 #include <vector>
 
 /** Is recv_writer_thread active? */
@@ -210,9 +211,24 @@ struct recv_addr_t{
 };
 
 struct recv_dblwr_t {
-	/** Add a page frame to the doublewrite recovery buffer. */
-	void add(byte* page) {
-		pages.push_back(page);
+	/** Add a page frame to the doublewrite recovery buffer.
+	@param[in]	page	page frame */
+	void add(byte* page);
+
+	/** Take ownership of a buffer that holds page frames that were
+	read from the doublewrite files. */
+	void add_buf(byte* buf) {
+		bufs.push_back(buf);
+	}
+
+	/** Forget the page frames and free the owned buffers. */
+	void clear() {
+		pages.clear();
+		newest.clear();
+		for (list::iterator i = bufs.begin(); i != bufs.end(); ++i) {
+			ut_free(*i);
+		}
+		bufs.clear();
 	}
 
 	/** Find a doublewrite copy of a page.
@@ -226,6 +242,17 @@ struct recv_dblwr_t {
 
 	/** Recovered doublewrite buffer page frames */
 	list	pages;
+	/** Buffers allocated for the doublewrite files */
+	list	bufs;
+
+private:
+	typedef std::map<ib_uint64_t, byte*, std::less<ib_uint64_t>,
+			 ut_allocator<std::pair<const ib_uint64_t, byte*> > >
+		page_map;
+
+	/** The newest copy of each page in pages, keyed by
+	tablespace identifier and page number */
+	page_map	newest;
 };
 
 /** Recovery system data structure */
@@ -289,6 +316,8 @@ struct recv_sys_t{
 	hash_table_t*	addr_hash;/*!< hash table of file addresses of pages */
 	ulint		n_addrs;/*!< number of not processed hashed file
 				addresses in the hash table */
+	ulint		n_apply_threads;/*!< number of recv_apply_thread
+				that have not exited yet */
 
 	recv_dblwr_t	dblwr;
 
@@ -1462,10 +1462,21 @@ be other, synchronous, pending writes. */
 void
 os_aio_wait_until_no_pending_writes();
 
-/** Wakes up simulated aio i/o-handler threads if they have something to do. */
+/** Wakes up simulated aio i/o-handler threads if they have something to do.
+With io_uring, submits the requests that were posted with
+IORequest::DO_NOT_WAKE. */
 void
 os_aio_simulated_wake_handler_threads();
 
+#ifdef LINUX_IO_URING
+/** Register the buffer pool memory for io_uring fixed buffer I/O.
+This is a no-op unless innodb_use_io_uring is in effect.
+@param[in]	bufs	memory chunks
+@param[in]	n	number of chunks */
+void
+os_aio_register_buffers(const struct iovec* bufs, ulint n);
+#endif /* LINUX_IO_URING */
+
 #ifdef _WIN32
 /** This function can be called if one wants to post a batch of reads and
 prefers an i/o-handler thread to handle them all at once later. You must
@@ -43,6 +43,20 @@ Created 2/16/1997 Heikki Tuuri
 #define READ_VIEW_STATE_OPEN 2
 
 
+/**
+  Transactions that a commit sequence number view would not see, collected
+  by trx_sys_t::csn_evict() before the commit sequence numbers of some of
+  them are evicted from trx_sys_t::csn_log.
+*/
+struct csn_view_ids_t
+{
+  /** Sorted identifiers of the transactions that are not visible */
+  trx_ids_t ids;
+  /** Smallest serialisation number of those transactions */
+  trx_id_t low_limit_no;
+};
+
+
 /**
   Read view lists the trx ids of those transactions for which a consistent read
   should not see the modifications to the database.
@@ -71,7 +85,14 @@ class ReadView
 
 
 public:
-  ReadView(): m_state(READ_VIEW_STATE_CLOSED), m_low_limit_id(0) {}
+  ReadView(): m_state(READ_VIEW_STATE_CLOSED), m_low_limit_id(0), m_csn(0),
+    m_csn_ids(NULL) {}
+
+
+  ~ReadView()
+  {
+    UT_DELETE(m_csn_ids);
+  }
 
 
   /**
@@ -86,14 +107,38 @@ class ReadView
   void copy(const ReadView &other)
   {
     ut_ad(&other != this);
-    if (m_low_limit_no > other.m_low_limit_no)
-      m_low_limit_no= other.m_low_limit_no;
-    if (m_low_limit_id > other.m_low_limit_id)
-      m_low_limit_id= other.m_low_limit_id;
+    if (!other.m_csn)
+      merge(other.m_ids, other.m_low_limit_id, other.m_low_limit_no);
+    else if (const csn_view_ids_t *csn_ids= other.get_csn_ids())
+      merge(csn_ids->ids, other.m_low_limit_id,
+            std::min(other.m_low_limit_no, csn_ids->low_limit_no));
+    else
+    {
+      /* The caller must merge the transactions that committed after
+      other.m_csn, see trx_sys_t::clone_oldest_view(). */
+      merge(trx_ids_t(), other.m_low_limit_id, other.m_low_limit_no);
+    }
+  }
+
+
+  /**
+    Makes this view not see the given transactions.
+
+    @param ids           sorted transaction ids
+    @param low_limit_id  transaction ids that are not visible at all
+    @param low_limit_no  serialisation number of the oldest needed undo log
+  */
+  void merge(const trx_ids_t &ids, trx_id_t low_limit_id,
+             trx_id_t low_limit_no)
+  {
+    if (m_low_limit_no > low_limit_no)
+      m_low_limit_no= low_limit_no;
+    if (m_low_limit_id > low_limit_id)
+      m_low_limit_id= low_limit_id;
 
     trx_ids_t::iterator dst= m_ids.begin();
-    for (trx_ids_t::const_iterator src= other.m_ids.begin();
-         src != other.m_ids.end(); src++)
+    for (trx_ids_t::const_iterator src= ids.begin();
+         src != ids.end(); src++)
     {
       if (*src >= m_low_limit_id)
         break;
@@ -189,6 +234,37 @@ class ReadView
   }
 
 
+  /**
+    @return commit sequence number of the snapshot
+    @retval 0 if the view lists the active transactions instead
+  */
+  trx_id_t csn() const { return m_csn; }
+
+
+  /** @return transactions attached by trx_sys_t::csn_evict(), or NULL */
+  const csn_view_ids_t *get_csn_ids() const
+  {
+    return static_cast<const csn_view_ids_t*>(
+      my_atomic_loadptr(reinterpret_cast<void**>(
+        const_cast<csn_view_ids_t**>(&m_csn_ids))));
+  }
+
+
+  /**
+    Attaches the transactions that this view does not see, before
+    trx_sys_t::csn_evict() evicts their commit sequence numbers.
+
+    Protected by trx_sys.mutex, see trx_sys_t::clone_oldest_view() for the
+    protocol that prevents the owner thread from reopening the view.
+  */
+  void set_csn_ids(csn_view_ids_t *ids)
+  {
+    ut_ad(m_csn);
+    ut_ad(!m_csn_ids);
+    my_atomic_storeptr(reinterpret_cast<void**>(&m_csn_ids), ids);
+  }
+
+
 	/** Check whether transaction id is valid.
 	@param[in]	id		transaction id to check
 	@param[in]	name		table name */
@@ -216,6 +292,10 @@ class ReadView
 
 			return(false);
 
+		} else if (m_csn) {
+
+			return(csn_changes_visible(id));
+
 		} else if (m_ids.empty()) {
 
 			return(true);
@@ -257,8 +337,21 @@ class ReadView
 		return(m_low_limit_id);
 	}
 
+	/**
+	@return the up limit id */
+	trx_id_t up_limit_id() const
+	{
+		return(m_up_limit_id);
+	}
+
 
 private:
+	/** Check whether the changes by id are visible to a view that
+	consists of a commit sequence number.
+	@param[in]	id	transaction id, m_up_limit_id <= id < m_low_limit_id
+	@return whether the view sees the modifications of id */
+	bool csn_changes_visible(trx_id_t id) const;
+
 	/** The read should not see any transaction with trx id >= this
 	value. In other words, this is the "high water mark". */
 	trx_id_t	m_low_limit_id;
@@ -280,6 +373,16 @@ class ReadView
 	whose transaction number is strictly smaller (<) than this value:
 	they can be removed in purge if not needed by other views */
 	trx_id_t	m_low_limit_no;
+
+	/** Commit sequence number of the snapshot when innodb_read_view_csn
+	is set: the view sees the transactions whose commit sequence number is
+	not above this. 0 if the view lists the active transactions in m_ids. */
+	trx_id_t	m_csn;
+
+	/** Transactions that are not visible in a view with m_csn, attached
+	when their commit sequence numbers are evicted from trx_sys.csn_log;
+	NULL if none were evicted while the view was open */
+	csn_view_ids_t*	m_csn_ids;
 };
 
 #endif
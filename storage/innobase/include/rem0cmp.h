@@ -130,6 +130,30 @@ cmp_dtuple_rec_with_match_low(
 #define cmp_dtuple_rec_with_match(tuple,rec,offsets,fields)		\
 	cmp_dtuple_rec_with_match_low(					\
 		tuple,rec,offsets,dtuple_get_n_fields_cmp(tuple),fields)
+/** Choose the comparator of the leading fixed-length key fields
+(dict_index_t::cmp_fixed) for an index that is being added to the cache.
+@param[in,out]	index	index */
+void
+cmp_index_init(dict_index_t* index);
+/** Compare the leading fixed-length key fields of a data tuple and a
+physical record with the comparator that cmp_index_init() chose for the
+index, without invoking rec_get_offsets().
+@param[in]	dtuple		data tuple
+@param[in]	rec		B-tree record
+@param[in]	index		B-tree index
+@param[in,out]	matched_fields	number of completely matched fields
+@return the comparison result of dtuple and rec
+@retval 0 if the order was not resolved; unless *matched_fields
+equals dtuple_get_n_fields_cmp(dtuple), the remaining fields must be
+compared by cmp_dtuple_rec_with_match() */
+UNIV_INLINE
+int
+cmp_dtuple_rec_fixed(
+	const dtuple_t*		dtuple,
+	const rec_t*		rec,
+	const dict_index_t*	index,
+	ulint*			matched_fields)
+	MY_ATTRIBUTE((nonnull, warn_unused_result));
 /** Compare a data tuple to a physical record.
 @param[in]	dtuple		data tuple
 @param[in]	rec		B-tree or R-tree index record
@@ -187,11 +211,8 @@ cmp_rec_rec_simple(
 	const rec_t*		rec2,	/*!< in: physical record */
 	const ulint*		offsets1,/*!< in: rec_get_offsets(rec1, ...) */
 	const ulint*		offsets2,/*!< in: rec_get_offsets(rec2, ...) */
-	const dict_index_t*	index,	/*!< in: data dictionary index */
-	struct TABLE*		table)	/*!< in: MySQL table, for reporting
-					duplicate key value if applicable,
-					or NULL */
-	MY_ATTRIBUTE((nonnull(1,2,3,4), warn_unused_result));
+	const dict_index_t*	index)	/*!< in: data dictionary index */
+	MY_ATTRIBUTE((nonnull, warn_unused_result));
 /** Compare two B-tree records.
 @param[in] rec1 B-tree record
 @param[in] rec2 B-tree record
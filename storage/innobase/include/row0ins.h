@@ -214,6 +214,9 @@ struct ins_node_t{
 				/* This is the first index that reported
 				DB_DUPLICATE_KEY.  Used in the case of REPLACE
 				or INSERT ... ON DUPLICATE UPDATE. */
+	/** whether only the clustered index is being inserted into;
+	the secondary indexes will be built by row_merge_bulk_build() */
+	bool		bulk;
 	ulint		magic_n;
 };
 
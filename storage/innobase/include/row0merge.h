@@ -345,6 +345,25 @@ row_merge_build_indexes(
 	bool			drop_historical)
 	MY_ATTRIBUTE((warn_unused_result));
 
+/** Build the secondary indexes of a table from its clustered index,
+after rows were inserted into the empty table by row_bulk_insert_start().
+@param[in,out]	trx		transaction that inserted the rows
+@param[in,out]	table		table
+@param[in]	indexes		secondary indexes of the table
+@param[in]	key_numbers	MySQL key numbers
+@param[in]	n_indexes	size of indexes[]
+@param[in,out]	mysql_table	MySQL table, for reporting duplicate keys
+@return DB_SUCCESS or error code */
+dberr_t
+row_merge_bulk_build(
+	trx_t*			trx,
+	dict_table_t*		table,
+	dict_index_t**		indexes,
+	const ulint*		key_numbers,
+	ulint			n_indexes,
+	struct TABLE*		mysql_table)
+	MY_ATTRIBUTE((warn_unused_result));
+
 /********************************************************************//**
 Write a buffer to a block. */
 void
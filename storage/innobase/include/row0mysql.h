@@ -225,6 +225,17 @@ row_lock_table_autoinc_for_mysql(
 dberr_t
 row_lock_table(row_prebuilt_t* prebuilt);
 
+/** Start inserting into an empty table without maintaining its secondary
+indexes (innodb_bulk_insert). The table will be locked exclusively, and
+the caller must build the secondary indexes with row_merge_bulk_build()
+at the end of the statement. Nothing will be done if the table is not
+empty or its indexes cannot be built in this way.
+@param[in,out]	prebuilt	table handle
+@return error code or DB_SUCCESS */
+dberr_t
+row_bulk_insert_start(row_prebuilt_t* prebuilt)
+	MY_ATTRIBUTE((nonnull, warn_unused_result));
+
 /** System Versioning: row_insert_for_mysql() modes */
 enum ins_mode_t {
 	/* plain row (without versioning) */
@@ -687,6 +698,11 @@ struct row_prebuilt_t {
 	ins_node_t*	ins_node;	/*!< Innobase SQL insert node
 					used to perform inserts
 					to the table */
+	trx_id_t	bulk_trx_id;	/*!< the transaction that is
+					inserting into the empty table
+					without maintaining its secondary
+					indexes (innodb_bulk_insert), or 0;
+					see row_bulk_insert_start() */
 	byte*		ins_upd_rec_buff;/*!< buffer for storing data converted
 					to the Innobase format from the MySQL
 					format */
@@ -714,6 +730,14 @@ struct row_prebuilt_t {
 					and updates */
 	btr_pcur_t*	clust_pcur;	/*!< persistent cursor used in
 					some selects and updates */
+	ulint		read_ahead_parent;
+					/*!< page number of the node pointer
+					page from which pcur last read ahead
+					leaf pages, or FIL_NULL */
+	ulint		read_ahead_trigger;
+					/*!< page number of the leaf page on
+					whose arrival pcur should read ahead
+					further leaf pages, or FIL_NULL */
 	que_fork_t*	sel_graph;	/*!< dummy query graph used in
 					selects */
 	dtuple_t*	search_tuple;	/*!< prebuilt dtuple used in selects */
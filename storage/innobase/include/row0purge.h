@@ -117,6 +117,23 @@ struct purge_node_t{
 	ibool		done;	/* Debug flag */
 	trx_id_t	trx_id;	/*!< trx id for this purging record */
 
+	/** A secondary index leaf page on which a record was purged */
+	struct leaf_guess_t {
+		index_id_t	index_id;	/*!< index of the page, or 0 */
+		buf_block_t*	block;		/*!< the page */
+		ib_uint64_t	modify_clock;	/*!< block->modify_clock
+						when the guess was made */
+		ulint		withdraw_clock;	/*!< buf_withdraw_clock
+						when the guess was made */
+	};
+
+	/** Leaf pages on which row_purge_remove_sec_if_poss_leaf()
+	last purged, indexed by index_id modulo the array size. Undo log
+	records of a table are handed to the same purge node, and records
+	that are purged in a row tend to be near each other in the
+	indexes, so that the B-tree descent can often be skipped. */
+	leaf_guess_t	leaf_guess[8];
+
 #ifdef UNIV_DEBUG
 	/***********************************************************//**
 	Validate the persisent cursor. The purge node has two references
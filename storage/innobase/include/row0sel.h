@@ -213,6 +213,21 @@ row_count_rtree_recs(
 	ulint*		n_rows);	/*!< out: number of entries
 					seen in the consistent read */
 
+/** Count the records of the clustered index that are visible to a
+consistent read, by splitting the index into key ranges at its upper levels
+and counting the ranges on several threads that share the read view of the
+transaction.
+@param[in,out]	prebuilt	prebuilt struct in MySQL handle
+@param[in]	n_threads	number of threads, including the caller
+@param[out]	n_rows		number of visible records
+@return DB_SUCCESS or error code */
+dberr_t
+row_count_clust_recs(
+	row_prebuilt_t*	prebuilt,
+	ulint		n_threads,
+	ulint*		n_rows)
+	MY_ATTRIBUTE((nonnull, warn_unused_result));
+
 /*******************************************************************//**
 Checks if MySQL at the moment is allowed for this table to retrieve a
 consistent read result, or store it to the query cache.
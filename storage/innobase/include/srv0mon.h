@@ -215,6 +215,8 @@ enum monitor_id_t {
 	MONITOR_FLUSH_PCT_FOR_DIRTY,
 	MONITOR_FLUSH_PCT_FOR_LSN,
 	MONITOR_FLUSH_SYNC_WAITS,
+	MONITOR_FLUSH_WASTED_WRITES,
+	MONITOR_FLUSH_HOT_DEFERRED,
 	MONITOR_FLUSH_ADAPTIVE_TOTAL_PAGE,
 	MONITOR_FLUSH_ADAPTIVE_COUNT,
 	MONITOR_FLUSH_ADAPTIVE_PAGES,
@@ -298,6 +300,7 @@ enum monitor_id_t {
 	MONITOR_TRX_RO_COMMIT,
 	MONITOR_TRX_NL_RO_COMMIT,
 	MONITOR_TRX_COMMIT_UNDO,
+	MONITOR_TRX_COMMIT_BATCHED,
 	MONITOR_TRX_ROLLBACK,
 	MONITOR_TRX_ROLLBACK_SAVEPOINT,
 	MONITOR_TRX_ROLLBACK_ACTIVE,
@@ -334,6 +337,7 @@ enum monitor_id_t {
 	MONITOR_OVLD_LOG_WRITE_REQUEST,
 	MONITOR_OVLD_LOG_WRITES,
 	MONITOR_OVLD_LOG_PADDED,
+	MONITOR_LOG_PENDING_COPY_WAITS,
 
 	/* Page Manager related counters */
 	MONITOR_MODULE_PAGE,
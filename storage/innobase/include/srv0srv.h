@@ -88,6 +88,13 @@ struct srv_stats_t
 	space in the log buffer and have to flush it */
 	ulint_ctr_1_t		log_waits;
 
+	/** Number of times log_free_check() had to wait for page
+	flushing or for a checkpoint */
+	ulint_ctr_1_t		log_checkpoint_waits;
+
+	/** Time spent in those waits, in microseconds */
+	int64_ctr_1_t		log_checkpoint_wait_time;
+
 	/** Count the number of times the doublewrite buffer was flushed */
 	ulint_ctr_1_t		dblwr_writes;
 
@@ -275,6 +282,9 @@ OS (provided we compiled Innobase with it in), otherwise we will
 use simulated aio we build below with threads.
 Currently we support native aio on windows and linux */
 extern my_bool	srv_use_native_aio;
+/** innodb_use_io_uring: whether to use io_uring instead of libaio
+for the native aio on Linux */
+extern my_bool	srv_use_io_uring;
 extern my_bool	srv_numa_interleave;
 
 /* Use atomic writes i.e disable doublewrite buffer */
@@ -331,6 +341,10 @@ extern ulong	srv_purge_rseg_truncate_frequency;
 /** Enable or Disable Truncate of UNDO tablespace. */
 extern my_bool	srv_undo_log_truncate;
 
+/** innodb_read_view_csn: whether read views of transactions consist of
+a commit sequence number instead of a list of active transactions */
+extern my_bool	srv_read_view_csn;
+
 /* Optimize prefix index queries to skip cluster index lookup when possible */
 /* Enables or disables this prefix optimization.  Disabled by default. */
 extern my_bool	srv_prefix_index_cluster_optimization;
@@ -350,6 +364,7 @@ extern ulint	srv_log_buffer_size;
 extern ulong	srv_flush_log_at_trx_commit;
 extern uint	srv_flush_log_at_timeout;
 extern ulong	srv_log_write_ahead_size;
+extern my_bool	srv_log_parallel_copy;
 extern char	srv_adaptive_flushing;
 extern my_bool	srv_flush_sync;
 
@@ -400,7 +415,15 @@ extern ulint	srv_lock_table_size;
 extern ulint	srv_n_file_io_threads;
 extern my_bool	srv_random_read_ahead;
 extern ulong	srv_read_ahead_threshold;
+/** innodb_range_read_ahead */
+extern ulong	srv_range_read_ahead;
 extern ulint	srv_n_read_io_threads;
+/** innodb_recovery_apply_threads */
+extern ulong	srv_n_recv_apply_threads;
+/** innodb_tablespace_open_threads */
+extern ulong	srv_n_tablespace_open_threads;
+/** innodb_flush_hot_page_interval */
+extern ulong	srv_flush_hot_page_interval;
 extern ulint	srv_n_write_io_threads;
 
 /* Defragmentation, Origianlly facebook default value is 100, but it's too high */
@@ -473,6 +496,7 @@ extern my_bool			srv_stats_sample_traditional;
 
 extern ibool	srv_use_doublewrite_buf;
 extern ulong	srv_doublewrite_batch_size;
+extern ulong	srv_doublewrite_file_pages;
 extern ulong	srv_checksum_algorithm;
 
 extern double	srv_max_buf_pool_modified_pct;
@@ -562,6 +586,10 @@ extern ulong srv_n_purge_threads;
 /* the number of pages to purge in one batch */
 extern ulong srv_purge_batch_size;
 
+/** innodb_parallel_read_max_threads; the number of threads that may help
+all the SELECT COUNT(*) statements together */
+extern ulong srv_parallel_read_max_threads;
+
 /* the number of sync wait arrays */
 extern ulong srv_sync_array_size;
 
@@ -601,6 +629,7 @@ extern mysql_pfs_key_t	io_read_thread_key;
 extern mysql_pfs_key_t	io_write_thread_key;
 extern mysql_pfs_key_t	page_cleaner_thread_key;
 extern mysql_pfs_key_t	recv_writer_thread_key;
+extern mysql_pfs_key_t	recv_apply_thread_key;
 extern mysql_pfs_key_t	srv_error_monitor_thread_key;
 extern mysql_pfs_key_t	srv_lock_timeout_thread_key;
 extern mysql_pfs_key_t	srv_master_thread_key;
@@ -971,6 +1000,11 @@ struct export_var_t{
 	ulint innodb_dblwr_writes;		/*!< srv_dblwr_writes */
 	ibool innodb_have_atomic_builtins;	/*!< HAVE_ATOMIC_BUILTINS */
 	ulint innodb_log_waits;			/*!< srv_log_waits */
+	ulint innodb_log_checkpoint_waits;	/*!< srv_log_checkpoint_waits */
+	int64_t innodb_log_checkpoint_wait_time;/*!< log_checkpoint_wait_time
+						in milliseconds */
+	lsn_t innodb_checkpoint_age;		/*!< lsn - last_checkpoint_lsn */
+	lsn_t innodb_checkpoint_max_age;	/*!< max_checkpoint_age */
 	ulint innodb_log_write_requests;	/*!< srv_log_write_requests */
 	ulint innodb_log_writes;		/*!< srv_log_writes */
 	lsn_t innodb_os_log_written;		/*!< srv_os_log_written */
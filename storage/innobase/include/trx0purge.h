@@ -485,6 +485,9 @@ class purge_sys_t
 
 	undo::Truncate	undo_trunc;	/*!< Track UNDO tablespace marked
 					for truncate. */
+	mem_heap_t*	heap;		/*!< copies of the undo log records
+					of the current purge batch; emptied
+					when the next batch is attached */
 
 
   /**
@@ -172,6 +172,15 @@ struct trx_rseg_t {
 	UNDO-tablespace marked for truncate. */
 	bool				skip_allocation;
 
+	/** Committing transactions that wait for another thread to write
+	their serialisation history, linked through trx_t::commit_next
+	(modified with atomic operations) */
+	trx_t*				commit_queue;
+
+	/** Signalled after the mini-transaction that wrote the serialisation
+	history of queued transactions has been committed */
+	os_event_t			commit_event;
+
 	/** @return the commit ID of the last committed transaction */
 	trx_id_t last_trx_no() const { return last_commit >> 1; }
 
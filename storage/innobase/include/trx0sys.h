@@ -776,6 +776,22 @@ class rw_trx_hash_t
 };
 
 
+/** Number of slots in trx_sys_t::csn_log (a power of 2) */
+#define TRX_SYS_CSN_LOG_SIZE	65536
+
+/** Maps the identifier of a committed transaction to its commit
+sequence number, see trx_sys_t::csn_commit() */
+struct trx_csn_slot_t
+{
+  /** transaction identifier; 0 if unused, TRX_ID_MAX while being written */
+  trx_id_t id;
+  /** transaction serialisation number, or TRX_ID_MAX */
+  trx_id_t no;
+  /** commit sequence number; TRX_ID_MAX while it is being assigned */
+  trx_id_t csn;
+};
+
+
 /** The transaction system central memory data structure. */
 class trx_sys_t
 {
@@ -802,6 +818,34 @@ class trx_sys_t
   */
   MY_ALIGNED(CACHE_LINE_SIZE) int32 rseg_history_len;
 
+
+  /**
+    Commit sequence number of the latest transaction committed in memory,
+    if innodb_read_view_csn is set. Accessed with atomic operations.
+  */
+  MY_ALIGNED(CACHE_LINE_SIZE) trx_id_t m_csn;
+
+
+  /**
+    Transaction identifier below which no transaction was active when
+    clone_oldest_view() last took a snapshot. Accessed with atomic operations.
+  */
+  MY_ALIGNED(CACHE_LINE_SIZE) trx_id_t m_csn_clean_id;
+
+
+  /**
+    Lower bound of the commit sequence numbers of all open read views.
+    Updated under mutex by csn_evict(), read with atomic operations.
+  */
+  trx_id_t m_csn_oldest_view;
+
+
+  /**
+    Circular map from transaction identifiers to commit sequence numbers,
+    see csn_slot(); NULL unless innodb_read_view_csn is set
+  */
+  trx_csn_slot_t *csn_log;
+
   bool m_initialised;
 
 public:
@@ -974,6 +1018,92 @@ class trx_sys_t
   }
 
 
+  /** @return whether read views consist of a commit sequence number */
+  bool csn_enabled() const { return csn_log != NULL; }
+
+
+  /** @return the latest commit sequence number */
+  trx_id_t get_csn()
+  {
+    return static_cast<trx_id_t>
+           (my_atomic_load64(reinterpret_cast<int64*>(&m_csn)));
+  }
+
+
+  /**
+    @return transaction identifier below which all transactions were
+    committed before the current get_csn()
+  */
+  trx_id_t get_csn_clean_id()
+  {
+    return static_cast<trx_id_t>
+           (my_atomic_load64(reinterpret_cast<int64*>(&m_csn_clean_id)));
+  }
+
+
+  /**
+    Looks up the commit sequence number of a transaction in csn_log.
+
+    If the transaction is being committed, waits for the commit sequence
+    number to be assigned.
+
+    @param id  transaction identifier
+    @return commit sequence number
+    @retval 0  if the transaction is not in csn_log: it is either active or
+               its slot has been reused by another transaction
+  */
+  trx_id_t csn_find(trx_id_t id)
+  {
+    trx_csn_slot_t *slot= csn_slot(id);
+
+    for (;;)
+    {
+      if (trx_id_t(my_atomic_load64(reinterpret_cast<int64*>(&slot->id)))
+          != id)
+        return 0;
+      trx_id_t csn= static_cast<trx_id_t>
+                    (my_atomic_load64(reinterpret_cast<int64*>(&slot->csn)));
+      if (csn == TRX_ID_MAX)
+      {
+        ut_delay(1);
+        continue;
+      }
+      /* The slot may have been reused while we read csn. */
+      if (trx_id_t(my_atomic_load64(reinterpret_cast<int64*>(&slot->id)))
+          != id)
+        return 0;
+      return csn;
+    }
+  }
+
+
+  /**
+    Gets the csn_log slot of a transaction.
+
+    A transaction that commits changes consumes two identifiers: its id
+    and its serialisation number. Consecutive committed transactions thus
+    occupy consecutive slots.
+
+    @param id  transaction identifier
+    @return slot in csn_log
+  */
+  trx_csn_slot_t *csn_slot(trx_id_t id)
+  {
+    return &csn_log[(id >> 1) & (TRX_SYS_CSN_LOG_SIZE - 1)];
+  }
+
+
+  /**
+    Assigns a commit sequence number to a transaction that is being
+    committed in memory. Must be invoked before deregister_rw(), so that
+    read views that no longer find the transaction in rw_trx_hash will find
+    it in csn_log.
+
+    @param trx transaction
+  */
+  void csn_commit(trx_t *trx);
+
+
   /** Initialiser for m_max_trx_id and m_rw_trx_hash_version. */
   void init_max_trx_id(trx_id_t value)
   {
@@ -1140,6 +1270,41 @@ class trx_sys_t
   };
 
 
+  /**
+    Prepares for evicting a commit sequence number from csn_log by
+    attaching the lists of invisible transactions to the views that
+    could still need it.
+
+    @param caller_trx  used to get access to rw_trx_hash_pins
+    @param csn         commit sequence number that will be evicted
+  */
+  void csn_evict(trx_t *caller_trx, trx_id_t csn);
+
+
+  /**
+    Collects the transactions that a commit sequence number view does not
+    see.
+
+    @param caller_trx  used to get access to rw_trx_hash_pins
+    @param view        open view with view.csn() != 0
+    @return transactions for view.set_csn_ids()
+  */
+  csn_view_ids_t *csn_collect(trx_t *caller_trx, const ReadView &view);
+
+
+  /**
+    Collects the transactions in csn_log that were committed after a
+    commit sequence number, or are being committed.
+
+    @param csn       commit sequence number
+    @param limit_id  ignore transaction identifiers not below this
+    @param ids       array to append the transaction identifiers to
+    @param min_no    smallest serialisation number, updated
+  */
+  void csn_scan(trx_id_t csn, trx_id_t limit_id, trx_ids_t *ids,
+                trx_id_t *min_no);
+
+
   static my_bool copy_one_id(rw_trx_hash_element_t *element,
                              snapshot_ids_arg *arg)
   {
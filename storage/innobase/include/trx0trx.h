@@ -929,6 +929,15 @@ struct trx_t {
 	ib_uint64_t	start_time_micro; /*!< start time of transaction in
 					microseconds */
 	lsn_t		commit_lsn;	/*!< lsn at the time of the commit */
+	trx_t*		commit_next;	/*!< next transaction in
+					trx_rseg_t::commit_queue */
+	lsn_t		commit_batch_lsn;
+					/*!< LSN_MAX while another thread is
+					writing the serialisation history of
+					this transaction; then the commit lsn
+					of its mini-transaction; 0 if the
+					history is written by this thread
+					(atomic) */
 	table_id_t	table_id;	/*!< Table to drop iff dict_operation
 					== TRX_DICT_OP_TABLE, or 0. */
 	/*------------------------------*/
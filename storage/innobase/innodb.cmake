@@ -67,6 +67,20 @@ IF(UNIX)
     IF(HAVE_LIBAIO_H AND HAVE_LIBAIO)
       ADD_DEFINITIONS(-DLINUX_NATIVE_AIO=1)
       LINK_LIBRARIES(aio)
+
+      # io_uring is invoked through raw system calls; no liburing needed
+      CHECK_C_SOURCE_COMPILES("
+      #include <linux/io_uring.h>
+      #include <sys/syscall.h>
+      int main() {
+        struct io_uring_params p;
+        return (int) sizeof p + __NR_io_uring_setup + __NR_io_uring_enter
+          + __NR_io_uring_register + IORING_OP_READ_FIXED
+          + IORING_OP_WRITEV;
+      }" HAVE_LINUX_IO_URING)
+      IF(HAVE_LINUX_IO_URING)
+        ADD_DEFINITIONS(-DLINUX_IO_URING=1)
+      ENDIF()
     ENDIF()
     IF(HAVE_LIBNUMA)
       LINK_LIBRARIES(numa)
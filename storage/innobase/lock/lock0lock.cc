@@ -480,6 +480,11 @@ void lock_sys_t::create(ulint n_cells)
 
 	mutex_create(LATCH_ID_LOCK_SYS, &mutex);
 
+	for (ulint i = 0; i < LOCK_REC_HASH_N_SHARDS; i++) {
+		mutex_create(LATCH_ID_LOCK_REC_HASH,
+			     &rec_hash_shards[i].mutex);
+	}
+
 	mutex_create(LATCH_ID_LOCK_SYS_WAIT, &wait_mutex);
 
 	timeout_event = os_event_create(0);
@@ -516,7 +521,7 @@ void lock_sys_t::resize(ulint n_cells)
 {
 	ut_ad(this == &lock_sys);
 
-	mutex_enter(&mutex);
+	lock_mutex_enter();
 
 	hash_table_t* old_hash = rec_hash;
 	rec_hash = hash_create(n_cells);
@@ -561,9 +566,57 @@ void lock_sys_t::resize(ulint n_cells)
 		buf_pool_mutex_exit(buf_pool);
 	}
 
-	mutex_exit(&mutex);
+	lock_mutex_exit();
+}
+
+
+/**
+  Latch the rec_hash cell of a page, for granting a record lock
+  without acquiring the lock_sys.mutex.
+
+  @param[in] block buffer block
+  @return the acquired shard latch
+*/
+LockMutex* lock_sys_t::rec_hash_shard_enter(const buf_block_t* block)
+{
+	ut_ad(this == &lock_sys);
+	ut_ad(!lock_mutex_own());
+
+	for (;;) {
+		ulint		cell = buf_block_get_lock_hash_val(block);
+		LockMutex*	shard = rec_hash_shard(cell);
+
+		mutex_enter(shard);
+
+		/* resize() may have moved the page to another cell
+		while we were waiting. */
+		if (cell == buf_block_get_lock_hash_val(block)) {
+			return(shard);
+		}
+
+		mutex_exit(shard);
+	}
+}
+
+/** Acquire all rec_hash shard latches, after lock_sys.mutex. */
+void lock_sys_t::rec_hash_shards_enter()
+{
+	ut_ad(mutex.is_owned());
+
+	for (ulint i = 0; i < LOCK_REC_HASH_N_SHARDS; i++) {
+		mutex_enter(&rec_hash_shards[i].mutex);
+	}
 }
 
+/** Release all rec_hash shard latches, before lock_sys.mutex. */
+void lock_sys_t::rec_hash_shards_exit()
+{
+	ut_ad(mutex.is_owned());
+
+	for (ulint i = LOCK_REC_HASH_N_SHARDS; i--; ) {
+		mutex_exit(&rec_hash_shards[i].mutex);
+	}
+}
 
 /** Closes the lock system at database shutdown. */
 void lock_sys_t::close()
@@ -586,6 +639,10 @@ void lock_sys_t::close()
 	mutex_destroy(&mutex);
 	mutex_destroy(&wait_mutex);
 
+	for (ulint i = 0; i < LOCK_REC_HASH_N_SHARDS; i++) {
+		mutex_destroy(&rec_hash_shards[i].mutex);
+	}
+
 	for (ulint i = srv_max_n_threads; i--; ) {
 		if (os_event_t& event = waiting_threads[i].event) {
 			os_event_destroy(event);
@@ -1022,7 +1079,7 @@ lock_rec_has_expl(
 {
 	lock_t*	lock;
 
-	ut_ad(lock_mutex_own());
+	ut_ad(lock_rec_queue_own(lock_sys.rec_hash, block));
 	ut_ad((precise_mode & LOCK_MODE_MASK) == LOCK_S
 	      || (precise_mode & LOCK_MODE_MASK) == LOCK_X);
 	ut_ad(!(precise_mode & LOCK_INSERT_INTENTION));
@@ -1071,7 +1128,7 @@ lock_rec_other_has_expl_req(
 					are taken into account */
 {
 
-	ut_ad(lock_mutex_own());
+	ut_ad(lock_rec_queue_own(lock_sys.rec_hash, block));
 	ut_ad(mode == LOCK_X || mode == LOCK_S);
 
 	/* Only GAP lock can be on SUPREMUM, and we are not looking for
@@ -1184,7 +1241,7 @@ lock_rec_other_has_conflicting(
 {
 	lock_t*		lock;
 
-	ut_ad(lock_mutex_own());
+	ut_ad(lock_rec_queue_own(lock_sys.rec_hash, block));
 
 	bool	is_supremum = (heap_no == PAGE_HEAP_NO_SUPREMUM);
 
@@ -1363,7 +1420,8 @@ lock_rec_create_low(
 	ulint		n_bits;
 	ulint		n_bytes;
 
-	ut_ad(lock_mutex_own());
+	ut_ad(lock_sys.hash_cell_own(lock_hash_get(type_mode),
+				     lock_rec_hash(space, page_no)));
 	ut_ad(holds_trx_mutex == trx_mutex_own(trx));
 	ut_ad(dict_index_is_clust(index) || !dict_index_is_online_ddl(index));
 
@@ -1432,7 +1490,9 @@ lock_rec_create_low(
  	}
 	lock_rec_bitmap_reset(lock);
 	lock_rec_set_nth_bit(lock, heap_no);
-	index->table->n_rec_locks++;
+	/* Locks on other pages of the table may be created concurrently
+	under other rec_hash shard latches. */
+	my_atomic_addlint(&index->table->n_rec_locks, 1);
 	ut_ad(index->table->n_ref_count > 0 || !index->table->can_be_evicted);
 
 #ifdef WITH_WSREP
@@ -1525,8 +1585,8 @@ lock_rec_create_low(
 	if (!holds_trx_mutex) {
 		trx_mutex_exit(trx);
 	}
-	MONITOR_INC(MONITOR_RECLOCK_CREATED);
-	MONITOR_INC(MONITOR_NUM_RECLOCK);
+	MONITOR_ATOMIC_INC(MONITOR_RECLOCK_CREATED);
+	MONITOR_ATOMIC_INC(MONITOR_NUM_RECLOCK);
 
 	return lock;
 }
@@ -1824,7 +1884,7 @@ lock_rec_add_to_queue(
 					transaction mutex */
 {
 #ifdef UNIV_DEBUG
-	ut_ad(lock_mutex_own());
+	ut_ad(lock_rec_queue_own(lock_hash_get(type_mode), block));
 	ut_ad(caller_owns_trx_mutex == trx_mutex_own(trx));
 	ut_ad(dict_index_is_clust(index)
 	      || dict_index_get_online_status(index) != ONLINE_INDEX_CREATION);
@@ -1928,6 +1988,86 @@ lock_rec_add_to_queue(
 		type_mode, block, heap_no, index, trx, caller_owns_trx_mutex);
 }
 
+/** Try to lock a record while holding only the rec_hash shard latch
+of the page. This succeeds if no other transaction holds a conflicting
+lock on the record. Waiting, deadlock detection and Galera conflict
+resolution require lock_sys.mutex and are left to the caller.
+@param[in]	impl	if true, no lock is set if no wait is
+			necessary: we assume that the caller will
+			set an implicit lock
+@param[in]	mode	lock mode: LOCK_X or LOCK_S possibly ORed to
+			either LOCK_GAP or LOCK_REC_NOT_GAP
+@param[in]	block	buffer block containing the record
+@param[in]	heap_no	heap number of the record
+@param[in]	index	index of the record
+@param[in,out]	trx	transaction
+@param[out]	err	DB_SUCCESS or DB_SUCCESS_LOCKED_REC
+@return whether the request was granted */
+static
+bool
+lock_rec_lock_shard(
+	bool			impl,
+	ulint			mode,
+	const buf_block_t*	block,
+	ulint			heap_no,
+	dict_index_t*		index,
+	trx_t*			trx,
+	dberr_t*		err)
+{
+#ifdef WITH_WSREP
+	if (wsrep_on_trx(trx)) {
+		return(false);
+	}
+#endif /* WITH_WSREP */
+
+	LockMutex*	shard = lock_sys.rec_hash_shard_enter(block);
+	lock_t*		lock = lock_rec_get_first_on_page(
+		lock_sys.rec_hash, block);
+
+	*err = DB_SUCCESS;
+
+	if (lock == NULL) {
+		if (!impl) {
+			lock_rec_create(
+#ifdef WITH_WSREP
+				NULL, NULL,
+#endif /* WITH_WSREP */
+				mode, block, heap_no, index, trx, false);
+		}
+
+		*err = DB_SUCCESS_LOCKED_REC;
+		mutex_exit(shard);
+		return(true);
+	}
+
+	trx_mutex_enter(trx);
+
+	if (!lock_rec_get_next_on_page(lock)
+	    && lock->trx == trx
+	    && lock->type_mode == (mode | LOCK_REC)
+	    && lock_rec_get_n_bits(lock) > heap_no) {
+		if (!impl && !lock_rec_get_nth_bit(lock, heap_no)) {
+			lock_rec_set_nth_bit(lock, heap_no);
+			*err = DB_SUCCESS_LOCKED_REC;
+		}
+	} else if (lock_rec_has_expl(mode, block, heap_no, trx)) {
+		/* The trx already has a strong enough lock on rec. */
+	} else if (lock_rec_other_has_conflicting(
+			   mode, block, heap_no, trx)) {
+		trx_mutex_exit(trx);
+		mutex_exit(shard);
+		return(false);
+	} else if (!impl) {
+		lock_rec_add_to_queue(LOCK_REC | mode, block, heap_no,
+				      index, trx, true);
+		*err = DB_SUCCESS_LOCKED_REC;
+	}
+
+	trx_mutex_exit(trx);
+	mutex_exit(shard);
+	return(true);
+}
+
 /*********************************************************************//**
 Tries to lock the specified record in the mode requested. If not immediately
 possible, enqueues a waiting lock request. This is a low-level function
@@ -1963,13 +2103,20 @@ lock_rec_lock(
         (mode & LOCK_TYPE_MASK) == 0);
   ut_ad(dict_index_is_clust(index) || !dict_index_is_online_ddl(index));
   DBUG_EXECUTE_IF("innodb_report_deadlock", return DB_DEADLOCK;);
-
-  lock_mutex_enter();
   ut_ad((LOCK_MODE_MASK & mode) != LOCK_S ||
         lock_table_has(trx, index->table, LOCK_IS));
   ut_ad((LOCK_MODE_MASK & mode) != LOCK_X ||
          lock_table_has(trx, index->table, LOCK_IX));
 
+  /* Non-conflicting requests only touch the lock queue of this page. */
+  if (lock_rec_lock_shard(impl, mode, block, heap_no, index, trx, &err))
+  {
+    MONITOR_ATOMIC_INC(MONITOR_NUM_RECLOCK_REQ);
+    return err;
+  }
+
+  lock_mutex_enter();
+
   if (lock_t *lock= lock_rec_get_first_on_page(lock_sys.rec_hash, block))
   {
     trx_mutex_enter(trx);
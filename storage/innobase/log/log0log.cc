@@ -133,6 +133,18 @@ extern "C" UNIV_INTERN
 os_thread_ret_t
 DECLARE_THREAD(log_scrub_thread)(void*);
 
+/** Event to wake up log_checkpointer_thread */
+os_event_t	log_checkpointer_event;
+/** Whether log_checkpointer_thread is active */
+bool		log_checkpointer_thread_active;
+
+/** How often log_checkpointer_thread wakes up, in microseconds */
+static const ulint	LOG_CHECKPOINTER_INTERVAL = 100000;
+
+/** How many seconds of redo log generation log_checkpointer_thread
+plans ahead for; the page cleaner acts on its request once a second */
+static const ulint	LOG_CHECKPOINTER_LOOKAHEAD = 2;
+
 /******************************************************//**
 Completes a checkpoint write i/o to a log file. */
 static
@@ -140,6 +152,12 @@ void
 log_io_complete_checkpoint(void);
 /*============================*/
 
+/** Wait until all areas reserved with log_reserve_for_copy() have been
+copied. */
+static
+void
+log_wait_for_pending_copies();
+
 /****************************************************************//**
 Returns the oldest modified block lsn in the pool, or log_sys->lsn if none
 exists.
@@ -215,6 +233,8 @@ log_buffer_extend(
 		log_mutex_enter_all();
 	}
 
+	log_wait_for_pending_copies();
+
 	move_start = ut_calc_align_down(
 		log_sys->buf_free,
 		OS_FILE_LOG_BLOCK_SIZE);
@@ -402,14 +422,16 @@ log_reserve_and_open(
 	return(log_sys->lsn);
 }
 
-/************************************************************//**
-Writes to the log the string given. It is assumed that the caller holds the
-log mutex. */
+/** Advance log_sys->lsn and log_sys->buf_free over a string, and
+optionally copy the string to the log buffer.
+@param[in]	str	string, or NULL if it will be copied later
+by log_write_reserved()
+@param[in]	str_len	string length */
+static
 void
-log_write_low(
-/*==========*/
-	const byte*	str,		/*!< in: string */
-	ulint		str_len)	/*!< in: string length */
+log_write_low_advance(
+	const byte*	str,
+	ulint		str_len)
 {
 	log_t*	log	= log_sys;
 	ulint	len;
@@ -435,10 +457,12 @@ log_write_low(
 			- LOG_BLOCK_TRL_SIZE;
 	}
 
-	ut_memcpy(log->buf + log->buf_free, str, len);
+	if (str != NULL) {
+		ut_memcpy(log->buf + log->buf_free, str, len);
+		str = str + len;
+	}
 
 	str_len -= len;
-	str = str + len;
 
 	log_block = static_cast<byte*>(
 		ut_align_down(
@@ -472,6 +496,106 @@ log_write_low(
 	srv_stats.log_write_requests.inc();
 }
 
+/************************************************************//**
+Writes to the log the string given. It is assumed that the caller holds the
+log mutex. */
+void
+log_write_low(
+/*==========*/
+	const byte*	str,		/*!< in: string */
+	ulint		str_len)	/*!< in: string length */
+{
+	ut_ad(str != NULL);
+	log_write_low_advance(str, str_len);
+}
+
+/** Reserve space in the log buffer for a string that will be copied by
+log_write_reserved() after log_sys->mutex has been released.
+The log must be closed with log_close, and the reservation must be
+completed with log_write_reserved_complete().
+@param[in]	len	length of the data to be written
+@return byte offset of the reserved area in log_sys->buf */
+ulint
+log_reserve_for_copy(
+	ulint	len)
+{
+	ut_ad(log_mutex_own());
+	ut_ad(len > 0);
+
+	const ulint	offset = log_sys->buf_free;
+
+	/* The block headers and trailers are initialized here,
+	while holding log_sys->mutex. Only the payload bytes of the
+	reserved area will be written by log_write_reserved(). */
+	log_write_low_advance(NULL, len);
+
+	my_atomic_addlint(&log_sys->n_pending_copies, 1);
+
+	return(offset);
+}
+
+/** Copy a part of a string to an area reserved by log_reserve_for_copy(),
+skipping the log block headers and trailers. This does not require
+log_sys->mutex.
+@param[in,out]	buf	log_sys->buf at the time of the reservation
+@param[in,out]	offset	byte offset in buf; advanced past the copied data
+@param[in]	str	string
+@param[in]	len	string length */
+void
+log_write_reserved(
+	byte*		buf,
+	ulint*		offset,
+	const byte*	str,
+	ulint		len)
+{
+	ut_ad(my_atomic_loadlint(&log_sys->n_pending_copies) > 0);
+
+	while (len > 0) {
+		ulint	in_block = *offset % OS_FILE_LOG_BLOCK_SIZE;
+
+		ut_ad(in_block >= LOG_BLOCK_HDR_SIZE);
+
+		if (in_block == OS_FILE_LOG_BLOCK_SIZE - LOG_BLOCK_TRL_SIZE) {
+			/* Skip the trailer of this block and the
+			header of the next block, just like
+			log_write_low_advance() did. */
+			*offset += LOG_BLOCK_TRL_SIZE + LOG_BLOCK_HDR_SIZE;
+			continue;
+		}
+
+		ulint	part = std::min(
+			len,
+			OS_FILE_LOG_BLOCK_SIZE - LOG_BLOCK_TRL_SIZE
+			- in_block);
+
+		::memcpy(buf + *offset, str, part);
+
+		*offset += part;
+		str += part;
+		len -= part;
+	}
+}
+
+/** Wait until all areas reserved with log_reserve_for_copy() have been
+copied. No new reservations can be made, because the caller holds
+log_sys->mutex, and the copying threads do not acquire it. */
+static
+void
+log_wait_for_pending_copies()
+{
+	ut_ad(log_mutex_own());
+
+	if (!my_atomic_loadlint(&log_sys->n_pending_copies)) {
+		return;
+	}
+
+	MONITOR_INC(MONITOR_LOG_PENDING_COPY_WAITS);
+
+	while (my_atomic_loadlint(&log_sys->n_pending_copies)) {
+		ut_delay(srv_spin_wait_delay);
+	}
+}
+
 /************************************************************//**
 Closes the log.
 @return lsn */
@@ -745,6 +869,8 @@ log_sys_init()
 
 	os_event_set(log_sys->flush_event);
 
+	log_checkpointer_event = os_event_create("log_checkpointer_event");
+
 	/*----------------------------*/
 
 	log_sys->last_checkpoint_lsn = log_sys->lsn;
@@ -1189,6 +1315,8 @@ log_write_up_to(
 	}
 
 	log_mutex_enter();
+	log_wait_for_pending_copies();
+
 	if (!flush_to_disk
 	    && log_sys->buf_free == log_sys->buf_next_to_write) {
 		/* Nothing to write and no flush to disk requested */
@@ -1778,6 +1906,7 @@ log_checkpoint_margin(void)
 	ib_uint64_t	advance;
 	lsn_t		oldest_lsn;
 	bool		success;
+	uintmax_t	wait_start	= 0;
 loop:
 	advance = 0;
 
@@ -1786,6 +1915,11 @@ log_checkpoint_margin(void)
 
 	if (!log->check_flush_or_checkpoint) {
 		log_mutex_exit();
+
+		if (wait_start) {
+			srv_stats.log_checkpoint_wait_time.add(
+				ut_time_us(NULL) - wait_start);
+		}
 		return;
 	}
 
@@ -1819,8 +1953,24 @@ log_checkpoint_margin(void)
 		log->check_flush_or_checkpoint = false;
 	}
 
+	if (advance || checkpoint_sync) {
+		/* The hard limits were reached: this thread must wait
+		for the page cleaner or for a checkpoint. */
+		if (!wait_start) {
+			wait_start = ut_time_us(NULL);
+			srv_stats.log_checkpoint_waits.inc();
+		}
+	} else if (do_checkpoint && log_checkpointer_thread_active) {
+		/* Leave the asynchronous checkpoint to the background. */
+		do_checkpoint = false;
+	}
+
 	log_mutex_exit();
 
+	if (log_checkpointer_thread_active) {
+		os_event_set(log_checkpointer_event);
+	}
+
 	if (advance) {
 		lsn_t	new_oldest = oldest_lsn + advance;
 
@@ -1847,6 +1997,11 @@ log_checkpoint_margin(void)
 			goto loop;
 		}
 	}
+
+	if (wait_start) {
+		srv_stats.log_checkpoint_wait_time.add(
+			ut_time_us(NULL) - wait_start);
+	}
 }
 
 /**
@@ -1869,6 +2024,83 @@ log_check_margins(void)
 	} while (check);
 }
 
+/** Background thread that writes checkpoints and tells the page cleaner
+how far the oldest modification has to advance, so that user threads do
+not have to do either in log_free_check().
+@return this function does not return, it calls os_thread_exit() */
+extern "C"
+os_thread_ret_t
+DECLARE_THREAD(log_checkpointer_thread)(void*)
+{
+	my_thread_init();
+	ut_ad(!srv_read_only_mode);
+
+	lsn_t		prev_lsn	= log_get_lsn();
+	uintmax_t	prev_time	= ut_time_us(NULL);
+	/* Redo log generation rate in bytes per second, smoothed over
+	roughly the last second */
+	lsn_t		lsn_rate	= 0;
+
+	while (srv_shutdown_state == SRV_SHUTDOWN_NONE) {
+		os_event_wait_time(log_checkpointer_event,
+				   LOG_CHECKPOINTER_INTERVAL);
+		os_event_reset(log_checkpointer_event);
+
+		if (srv_shutdown_state != SRV_SHUTDOWN_NONE) {
+			break;
+		}
+
+		log_mutex_enter();
+		const lsn_t	lsn		= log_sys->lsn;
+		const lsn_t	oldest_lsn
+			= log_buf_pool_get_oldest_modification();
+		const lsn_t	checkpoint_lsn	= log_sys->last_checkpoint_lsn;
+		const lsn_t	max_age_async	= log_sys->max_modified_age_async;
+		const lsn_t	max_age_sync	= log_sys->max_modified_age_sync;
+		log_mutex_exit();
+
+		const uintmax_t	now = ut_time_us(NULL);
+
+		if (now > prev_time) {
+			lsn_rate = lsn_rate - lsn_rate / 8
+				+ (lsn - prev_lsn) * 1000000
+				/ (now - prev_time) / 8;
+			prev_lsn = lsn;
+			prev_time = now;
+		}
+
+		/* If the redo log keeps being generated at the current
+		rate, the age of the oldest modification would exceed
+		max_modified_age_async unless it advanced this far. */
+		const lsn_t	horizon = lsn
+			+ lsn_rate * LOG_CHECKPOINTER_LOOKAHEAD;
+
+		buf_flush_set_pace_lsn(horizon - oldest_lsn > max_age_async
+				       ? horizon - max_age_async : 0);
+
+		/* The checkpoint age is the age of the oldest modification
+		plus the distance from the checkpoint to it. Keep the latter
+		below half of the gap between the asynchronous and the
+		synchronous preflush limits, so that log_close() will not
+		request a checkpoint from log_free_check() as long as the
+		page cleaner keeps up. */
+		if (oldest_lsn - checkpoint_lsn
+		    > (max_age_sync - max_age_async) / 2) {
+			log_checkpoint(true, false);
+		}
+	}
+
+	buf_flush_set_pace_lsn(0);
+	log_checkpointer_thread_active = false;
+
+	my_thread_end();
+	/* We count the number of threads in os_thread_exit(). A created
+	thread should always use that to exit and not use return() to exit. */
+	os_thread_exit();
+
+	OS_THREAD_DUMMY_RETURN;
+}
+
 /****************************************************************//**
 Makes a checkpoint at the latest lsn and writes it to first page of each
 data file in the database, so that we know that the file spaces contain
@@ -1905,6 +2137,9 @@ logs_empty_and_mark_files_at_shutdown(void)
 		} else {
 			ut_ad(!srv_dict_stats_thread_active);
 		}
+		if (log_checkpointer_thread_active) {
+			os_event_set(log_checkpointer_event);
+		}
 		if (recv_sys && recv_sys->flush_start) {
 			/* This is in case recv_writer_thread was never
 			started, or buf_flush_page_cleaner_coordinator
@@ -1960,6 +2195,8 @@ logs_empty_and_mark_files_at_shutdown(void)
 		goto wait_suspend_loop;
 	} else if (btr_defragment_thread_active) {
 		thread_name = "btr_defragment_thread";
+	} else if (log_checkpointer_thread_active) {
+		thread_name = "log_checkpointer_thread";
 	} else if (srv_fast_shutdown != 2 && trx_rollback_is_active) {
 		thread_name = "rollback of recovered transactions";
 	} else {
@@ -2268,6 +2505,7 @@ log_shutdown()
 	log_sys->checkpoint_buf = NULL;
 
 	os_event_destroy(log_sys->flush_event);
+	os_event_destroy(log_checkpointer_event);
 
 	rw_lock_free(&log_sys->checkpoint_lock);
 
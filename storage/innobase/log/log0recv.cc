@@ -122,6 +122,7 @@ static lsn_t	recv_max_page_lsn;
 #ifdef UNIV_PFS_THREAD
 mysql_pfs_key_t	trx_rollback_clean_thread_key;
 mysql_pfs_key_t	recv_writer_thread_key;
+mysql_pfs_key_t	recv_apply_thread_key;
 #endif /* UNIV_PFS_THREAD */
 
 /** Is recv_writer_thread active? */
@@ -443,7 +444,7 @@ void
 recv_sys_close()
 {
 	if (recv_sys != NULL) {
-		recv_sys->dblwr.pages.clear();
+		recv_sys->dblwr.clear();
 
 		if (recv_sys->addr_hash != NULL) {
 			hash_table_free(recv_sys->addr_hash);
@@ -620,6 +621,9 @@ recv_sys_debug_free(void)
 	recv_sys->heap = NULL;
 	recv_sys->addr_hash = NULL;
 
+	/* Any doublewrite pages were consumed by buf_dblwr_process(). */
+	recv_sys->dblwr.clear();
+
 	/* wake page cleaner up to progress */
 	if (!srv_read_only_mode) {
 		ut_ad(!recv_recovery_on);
@@ -1923,50 +1927,53 @@ recv_read_in_area(
 	return(n);
 }
 
-/** Apply the hash table of stored log records to persistent data pages.
-@param[in]	last_batch	whether the change buffer merge will be
-				performed as part of the operation */
+/** Read in a page that has hashed log records, and apply the records
+to it in the calling thread. The neighbouring pages are not read ahead,
+because they may belong to the partitions of other recovery threads.
+@param[in]	page_id	page id */
+static
 void
-recv_apply_hashed_log_recs(bool last_batch)
+recv_read_in_page(const page_id_t& page_id)
 {
-	ut_ad(srv_operation == SRV_OPERATION_NORMAL
-	      || srv_operation == SRV_OPERATION_RESTORE
-	      || srv_operation == SRV_OPERATION_RESTORE_EXPORT);
+	ulint	page_no = page_id.page_no();
 
 	mutex_enter(&recv_sys->mutex);
 
-	while (recv_sys->apply_batch_on) {
-		bool abort = recv_sys->found_corrupt_log;
-		mutex_exit(&recv_sys->mutex);
+	recv_addr_t*	recv_addr = recv_get_fil_addr_struct(
+		page_id.space(), page_no);
+	const bool	read = recv_addr->state == RECV_NOT_PROCESSED;
 
-		if (abort) {
-			return;
-		}
-
-		os_thread_sleep(500000);
-		mutex_enter(&recv_sys->mutex);
+	if (read) {
+		recv_addr->state = RECV_BEING_READ;
 	}
 
-	ut_ad(!last_batch == log_mutex_own());
+	mutex_exit(&recv_sys->mutex);
 
-	recv_no_ibuf_operations = !last_batch
-		|| srv_operation == SRV_OPERATION_RESTORE
-		|| srv_operation == SRV_OPERATION_RESTORE_EXPORT;
+	if (read) {
+		/* buf_page_io_complete() applies the log records
+		when the synchronous read completes. */
+		buf_read_recv_pages(true, page_id.space(), &page_no, 1);
+	}
+}
 
-	ut_d(recv_no_log_write = recv_no_ibuf_operations);
+/** Apply the hashed log records to the pages in a partition of
+recv_sys->addr_hash. If there is only one partition, pages that are not
+in the buffer pool are read in asynchronously, and the log records will
+be applied to them by the I/O handler threads. Otherwise, each page is
+read in synchronously, and the calling thread applies the log records.
+@param[in]	part	partition number; the hash table cells whose
+number modulo n_parts is part will be processed
+@param[in]	n_parts	number of partitions */
+static
+void
+recv_apply_hashed_log_recs_low(ulint part, ulint n_parts)
+{
+	ut_ad(part < n_parts);
 
-	if (ulint n = recv_sys->n_addrs) {
-		const char* msg = last_batch
-			? "Starting final batch to recover "
-			: "Starting a batch to recover ";
-		ib::info() << msg << n << " pages from redo log.";
-		sd_notifyf(0, "STATUS=%s" ULINTPF " pages from redo log",
-			   msg, n);
-	}
-	recv_sys->apply_log_recs = TRUE;
-	recv_sys->apply_batch_on = TRUE;
+	mutex_enter(&recv_sys->mutex);
 
-	for (ulint i = 0; i < hash_get_n_cells(recv_sys->addr_hash); i++) {
+	for (ulint i = part; i < hash_get_n_cells(recv_sys->addr_hash);
+	     i += n_parts) {
 		for (recv_addr_t* recv_addr = static_cast<recv_addr_t*>(
 			     HASH_GET_FIRST(recv_sys->addr_hash, i));
 		     recv_addr;
@@ -2013,8 +2020,10 @@ recv_apply_hashed_log_recs(bool last_batch)
 
 					recv_recover_page(FALSE, block);
 					mtr.commit();
-				} else {
+				} else if (n_parts == 1) {
 					recv_read_in_area(page_id);
+				} else {
+					recv_read_in_page(page_id);
 				}
 
 				mutex_enter(&recv_sys->mutex);
@@ -2022,10 +2031,110 @@ recv_apply_hashed_log_recs(bool last_batch)
 		}
 	}
 
-	/* Wait until all the pages have been processed */
+	mutex_exit(&recv_sys->mutex);
+}
+
+/******************************************************************//**
+recv_apply thread tasked with applying the hashed log records to the
+pages of a partition of recv_sys->addr_hash.
+@return a dummy parameter */
+extern "C"
+os_thread_ret_t
+DECLARE_THREAD(recv_apply_thread)(
+/*==============================*/
+	void*	arg)	/*!< in: partition number */
+{
+	my_thread_init();
+
+#ifdef UNIV_PFS_THREAD
+	pfs_register_thread(recv_apply_thread_key);
+#endif /* UNIV_PFS_THREAD */
 
-	while (recv_sys->n_addrs != 0) {
+	recv_apply_hashed_log_recs_low(ulint(arg), srv_n_recv_apply_threads);
+
+	mutex_enter(&recv_sys->mutex);
+	ut_a(recv_sys->n_apply_threads > 0);
+	recv_sys->n_apply_threads--;
+	mutex_exit(&recv_sys->mutex);
+
+	my_thread_end();
+	/* We count the number of threads in os_thread_exit().
+	A created thread should always use that to exit and not
+	use return() to exit. */
+	os_thread_exit();
+
+	OS_THREAD_DUMMY_RETURN;
+}
+
+/** Apply the hash table of stored log records to persistent data pages.
+@param[in]	last_batch	whether the change buffer merge will be
+				performed as part of the operation */
+void
+recv_apply_hashed_log_recs(bool last_batch)
+{
+	ut_ad(srv_operation == SRV_OPERATION_NORMAL
+	      || srv_operation == SRV_OPERATION_RESTORE
+	      || srv_operation == SRV_OPERATION_RESTORE_EXPORT);
+
+	mutex_enter(&recv_sys->mutex);
+
+	while (recv_sys->apply_batch_on) {
 		bool abort = recv_sys->found_corrupt_log;
+		mutex_exit(&recv_sys->mutex);
+
+		if (abort) {
+			return;
+		}
+
+		os_thread_sleep(500000);
+		mutex_enter(&recv_sys->mutex);
+	}
+
+	ut_ad(!last_batch == log_mutex_own());
+
+	recv_no_ibuf_operations = !last_batch
+		|| srv_operation == SRV_OPERATION_RESTORE
+		|| srv_operation == SRV_OPERATION_RESTORE_EXPORT;
+
+	ut_d(recv_no_log_write = recv_no_ibuf_operations);
+
+	if (ulint n = recv_sys->n_addrs) {
+		const char* msg = last_batch
+			? "Starting final batch to recover "
+			: "Starting a batch to recover ";
+		ib::info() << msg << n << " pages from redo log.";
+		sd_notifyf(0, "STATUS=%s" ULINTPF " pages from redo log",
+			   msg, n);
+	}
+	recv_sys->apply_log_recs = TRUE;
+	recv_sys->apply_batch_on = TRUE;
+
+	const ulint	n_threads = recv_sys->n_addrs
+		? srv_n_recv_apply_threads : 1;
+	const ulint	n_pages = recv_sys->n_addrs;
+	const ulint	start_time = ut_time_ms();
+
+	ut_ad(n_threads > 0);
+	ut_ad(recv_sys->n_apply_threads == 0);
+	recv_sys->n_apply_threads = n_threads - 1;
+
+	mutex_exit(&recv_sys->mutex);
+
+	for (ulint i = 1; i < n_threads; i++) {
+		os_thread_create(recv_apply_thread,
+				 reinterpret_cast<void*>(i), NULL);
+	}
+
+	recv_apply_hashed_log_recs_low(0, n_threads);
+
+	mutex_enter(&recv_sys->mutex);
+
+	/* Wait until all the pages have been processed, and the
+	recv_apply_thread have exited */
+
+	while (recv_sys->n_addrs != 0 || recv_sys->n_apply_threads != 0) {
+		bool abort = recv_sys->found_corrupt_log
+			&& recv_sys->n_apply_threads == 0;
 
 		mutex_exit(&(recv_sys->mutex));
 
@@ -2033,11 +2142,18 @@ recv_apply_hashed_log_recs(bool last_batch)
 			return;
 		}
 
-		os_thread_sleep(500000);
+		os_thread_sleep(recv_sys->n_apply_threads ? 10000 : 500000);
 
 		mutex_enter(&(recv_sys->mutex));
 	}
 
+	if (n_pages) {
+		ib::info() << "Applied " << n_pages << " pages from redo log in "
+			<< ut_time_ms() - start_time << " ms using "
+			<< n_threads
+			<< (n_threads == 1 ? " thread" : " threads");
+	}
+
 	if (!last_batch) {
 		/* Flush all the file pages to disk and invalidate them in
 		the buffer pool */
@@ -3544,6 +3660,28 @@ recv_reset_logs(
 	log_mutex_enter();
 }
 
+/** Add a page frame to the doublewrite recovery buffer.
+@param[in]	page	page frame */
+void
+recv_dblwr_t::add(byte* page)
+{
+	pages.push_back(page);
+
+	/* The doublewrite files can hold several copies of a page.
+	Remember the newest one, so that find_page() need not scan
+	all the pages. */
+	std::pair<page_map::iterator, bool>	ins = newest.insert(
+		page_map::value_type(
+			ib_uint64_t(page_get_space_id(page)) << 32
+			| page_get_page_no(page), page));
+
+	if (!ins.second
+	    && mach_read_from_8(page + FIL_PAGE_LSN)
+	    > mach_read_from_8(ins.first->second + FIL_PAGE_LSN)) {
+		ins.first->second = page;
+	}
+}
+
 /** Find a doublewrite copy of a page.
 @param[in]	space_id	tablespace identifier
 @param[in]	page_no		page number
@@ -3553,40 +3691,10 @@ recv_reset_logs(
 const byte*
 recv_dblwr_t::find_page(ulint space_id, ulint page_no)
 {
-	typedef std::vector<const byte*, ut_allocator<const byte*> >
-		matches_t;
-
-	matches_t	matches;
-	const byte*	result = 0;
-
-	for (list::iterator i = pages.begin(); i != pages.end(); ++i) {
-		if (page_get_space_id(*i) == space_id
-		    && page_get_page_no(*i) == page_no) {
-			matches.push_back(*i);
-		}
-	}
-
-	if (matches.size() == 1) {
-		result = matches[0];
-	} else if (matches.size() > 1) {
-
-		lsn_t max_lsn	= 0;
-		lsn_t page_lsn	= 0;
-
-		for (matches_t::iterator i = matches.begin();
-		     i != matches.end();
-		     ++i) {
-
-			page_lsn = mach_read_from_8(*i + FIL_PAGE_LSN);
-
-			if (page_lsn > max_lsn) {
-				max_lsn = page_lsn;
-				result = *i;
-			}
-		}
-	}
+	page_map::const_iterator	i = newest.find(
+		ib_uint64_t(space_id) << 32 | page_no);
 
-	return(result);
+	return(i == newest.end() ? NULL : i->second);
 }
 
 #ifndef DBUG_OFF
@@ -385,7 +385,8 @@ class mtr_t::Command {
 	@param[in,out]	mtr	mini-transaction */
 	explicit Command(mtr_t* mtr)
 		:
-		m_locks_released()
+		m_locks_released(),
+		m_copy_buf()
 	{
 		init(mtr);
 	}
@@ -442,6 +443,14 @@ class mtr_t::Command {
 
 	/** End lsn of the possible log entry for this mtr */
 	lsn_t			m_end_lsn;
+
+	/** The log buffer in which space was reserved by
+	log_reserve_for_copy(), or NULL if the log was already copied
+	while holding log_sys->mutex */
+	byte*			m_copy_buf;
+
+	/** Start offset of the reserved area in m_copy_buf */
+	ulint			m_copy_offset;
 };
 
 /** Check if a mini-transaction is dirtying a clean page.
@@ -469,6 +478,30 @@ struct mtr_write_log_t {
 	}
 };
 
+/** Copy the block contents to an area reserved in the REDO log buffer */
+struct mtr_write_reserved_t {
+	/** Constructor.
+	@param[in,out]	buf	log buffer at the time of the reservation
+	@param[in]	offset	start offset of the reserved area */
+	mtr_write_reserved_t(byte* buf, ulint offset)
+		: m_buf(buf), m_offset(offset) {}
+
+	/** Append a block to the reserved area.
+	@return whether the appending should continue */
+	bool operator()(const mtr_buf_t::block_t* block)
+	{
+		log_write_reserved(m_buf, &m_offset,
+				   block->begin(), block->used());
+		return(true);
+	}
+
+private:
+	/** log buffer */
+	byte*	m_buf;
+	/** current offset in m_buf */
+	ulint	m_offset;
+};
+
 /** Append records to the system-wide redo log buffer.
 @param[in]	log	redo log records */
 void
@@ -850,6 +883,17 @@ mtr_t::Command::finish_write(
 	ut_ad(m_impl->m_log.size() == len);
 	ut_ad(len > 0);
 
+	if (srv_log_parallel_copy) {
+		/* Only reserve the space while holding log_sys->mutex.
+		The log records will be copied by execute() after the
+		mutex has been released. */
+		m_start_lsn = log_reserve_and_open(len);
+		m_copy_buf = log_sys->buf;
+		m_copy_offset = log_reserve_for_copy(len);
+		m_end_lsn = log_close();
+		return;
+	}
+
 	if (m_impl->m_log.is_small()) {
 		const mtr_buf_t::block_t*	front = m_impl->m_log.front();
 		ut_ad(len <= front->used());
@@ -927,6 +971,15 @@ mtr_t::Command::execute()
 	to insert into the flush list. */
 	log_mutex_exit();
 
+	if (m_copy_buf != NULL) {
+		/* Copy the log records to the area that finish_write()
+		reserved. Until log_write_reserved_complete(), any
+		log_write_up_to() will wait for us. */
+		mtr_write_reserved_t	write_log(m_copy_buf, m_copy_offset);
+		m_impl->m_log.for_each_block(write_log);
+		log_write_reserved_complete();
+	}
+
 	m_impl->m_mtr->m_commit_lsn = m_end_lsn;
 
 	release_blocks();
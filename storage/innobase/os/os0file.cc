@@ -64,6 +64,15 @@ Created 10/21/1995 Heikki Tuuri
 #include <libaio.h>
 #endif /* LINUX_NATIVE_AIO */
 
+#ifdef LINUX_IO_URING
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <poll.h>
+#include <algorithm>
+#endif /* LINUX_IO_URING */
+
 #ifdef HAVE_FALLOC_PUNCH_HOLE_AND_KEEP_SIZE
 # include <fcntl.h>
 # include <linux/falloc.h>
@@ -189,6 +198,7 @@ mysql_pfs_key_t  innodb_temp_file_key;
 #endif /* UNIV_PFS_IO */
 
 class AIO;
+class IOURing;
 
 /** The asynchronous I/O context */
 struct Slot {
@@ -269,6 +279,12 @@ struct Slot {
 
 	/** length of the block to read or write */
 	ulint			len;
+
+# ifdef LINUX_IO_URING
+	/** buffer of an io_uring request that is not in a
+	registered buffer */
+	struct iovec		iov;
+# endif /* LINUX_IO_URING */
 #else
 	/** length of the block to read or write */
 	ulint			len;
@@ -441,8 +457,32 @@ class AIO {
 	@return true if supported, false otherwise. */
 	static bool is_linux_native_aio_supported()
 		MY_ATTRIBUTE((warn_unused_result));
+
+	/** @return the io_uring shared by all segments of the array,
+	or NULL if each segment has its own libaio context */
+	IOURing* uring() const
+		MY_ATTRIBUTE((warn_unused_result))
+	{
+#ifdef LINUX_IO_URING
+		return(m_uring);
+#else
+		return(NULL);
+#endif /* LINUX_IO_URING */
+	}
 #endif /* LINUX_NATIVE_AIO */
 
+#ifdef LINUX_IO_URING
+	/** Submit the io_uring requests that were queued with
+	IORequest::DO_NOT_WAKE in any of the AIO arrays */
+	static void uring_submit_all();
+
+	/** Register the buffers of the read, write and ibuf arrays
+	that can be used for io_uring fixed buffer I/O.
+	@param[in]	bufs	buffers
+	@param[in]	n	number of buffers */
+	static void uring_register_buffers(const iovec* bufs, ulint n);
+#endif /* LINUX_IO_URING */
+
 #ifdef WIN_ASYNC_IO
 	HANDLE m_completion_port;
 	/** Wake up all AIO threads in Windows native aio */
@@ -636,6 +676,12 @@ class AIO {
 	IOEvents		m_events;
 #endif /* LINUX_NATIV_AIO */
 
+#ifdef LINUX_IO_URING
+	/** io_uring that replaces m_aio_ctx when innodb_use_io_uring
+	is set; shared by all segments of the array, or NULL */
+	IOURing*		m_uring;
+#endif /* LINUX_IO_URING */
+
 	/** The aio arrays for non-ibuf i/o and ibuf i/o, as well as
 	sync AIO. These are NULL when the module has not yet been
 	initialized. */
@@ -1650,6 +1696,493 @@ os_file_punch_hole_posix(
 	return(DB_IO_NO_PUNCH_HOLE);
 }
 
+#ifdef LINUX_IO_URING
+
+/** Submission and completion queues of a Linux io_uring. One ring is
+shared by all the segments of an AIO array, so that any I/O handler
+thread of the array can reap the completion of any of its requests. */
+class IOURing {
+public:
+	IOURing()
+		:
+		m_fd(-1),
+		m_sq_ring(MAP_FAILED),
+		m_sq_ring_size(),
+		m_cq_ring(MAP_FAILED),
+		m_cq_ring_size(),
+		m_sqes(static_cast<io_uring_sqe*>(MAP_FAILED)),
+		m_sqes_size(),
+		m_n_queued()
+	{
+		m_sq_mutex.init();
+		m_cq_mutex.init();
+	}
+
+	/** Destructor */
+	~IOURing()
+	{
+		if (m_sqes != MAP_FAILED) {
+			munmap(m_sqes, m_sqes_size);
+		}
+
+		if (m_cq_ring != MAP_FAILED && m_cq_ring != m_sq_ring) {
+			munmap(m_cq_ring, m_cq_ring_size);
+		}
+
+		if (m_sq_ring != MAP_FAILED) {
+			munmap(m_sq_ring, m_sq_ring_size);
+		}
+
+		if (m_fd >= 0) {
+			close(m_fd);
+		}
+
+		m_cq_mutex.destroy();
+		m_sq_mutex.destroy();
+	}
+
+	/** Set up the ring.
+	@param[in]	entries	minimum number of submission queue entries
+	@return whether the ring was set up; errno is set on failure */
+	bool create(ulint entries)
+		MY_ATTRIBUTE((warn_unused_result));
+
+	/** Check if io_uring can be used on this system. It could be
+	disabled by the kernel configuration or by a seccomp filter.
+	@return true if supported, false otherwise. */
+	static bool is_supported()
+		MY_ATTRIBUTE((warn_unused_result))
+	{
+		IOURing	ring;
+
+		return(ring.create(1));
+	}
+
+	/** Add a request to the submission queue.
+	@param[in,out]	slot	an already reserved slot
+	@param[in]	submit	whether to submit the request now, instead
+				of leaving it to a later submit() */
+	void queue(Slot* slot, bool submit);
+
+	/** Submit the queued requests.
+	@param[in]	wait	whether to wait for a thread that is
+				adding requests, or to leave the
+				submission to that thread */
+	void submit(bool wait)
+	{
+		if (wait) {
+			m_sq_mutex.enter();
+		} else if (!m_sq_mutex.try_lock()) {
+			return;
+		}
+
+		submit_low();
+
+		m_sq_mutex.exit();
+	}
+
+	/** Wait until the completion queue is not empty.
+	@param[in]	timeout_ms	timeout in milliseconds */
+	void wait(int timeout_ms) const
+	{
+		struct pollfd	pfd;
+
+		pfd.fd = m_fd;
+		pfd.events = POLLIN;
+		pfd.revents = 0;
+
+		::poll(&pfd, 1, timeout_ms);
+	}
+
+	/** Remove a completed request from the completion queue.
+	@param[out]	res	number of bytes read or written,
+				or a negative error code
+	@return the slot of the completed request, or NULL if none */
+	Slot* reap(ssize_t* res)
+		MY_ATTRIBUTE((warn_unused_result));
+
+	/** Register buffers for fixed buffer I/O, replacing any
+	previously registered buffers.
+	@param[in]	bufs	buffers
+	@param[in]	n	number of buffers
+	@return whether the buffers were registered */
+	bool register_buffers(const iovec* bufs, ulint n)
+		MY_ATTRIBUTE((warn_unused_result));
+
+private:
+	typedef std::vector<iovec, ut_allocator<iovec> > Buffers;
+
+	/** Submit the queued requests, retrying on a temporary
+	shortage of resources. The caller must hold m_sq_mutex. */
+	void submit_low();
+
+	/** Look up the registered buffer that contains a block.
+	@param[in]	ptr	start of the block
+	@param[in]	len	length of the block
+	@return index of the registered buffer, or -1 if none */
+	int find_buffer(const byte* ptr, ulint len) const
+		MY_ATTRIBUTE((warn_unused_result));
+
+	/** Order the registered buffers by address */
+	static bool buffer_less(const iovec& a, const iovec& b)
+	{
+		return(static_cast<const byte*>(a.iov_base)
+		       < static_cast<const byte*>(b.iov_base));
+	}
+
+	/** Largest buffer that the kernel accepts for registration */
+	static const ulint	MAX_BUFFER_SIZE = 1UL << 30;
+
+	/** Largest number of buffers that the kernel accepts */
+	static const ulint	MAX_BUFFERS = 1024;
+
+	/** file descriptor of the ring */
+	int			m_fd;
+
+	/** mapping of the submission queue ring */
+	void*			m_sq_ring;
+
+	/** size of m_sq_ring */
+	size_t			m_sq_ring_size;
+
+	/** mapping of the completion queue ring; can be equal to
+	m_sq_ring if the kernel maps both rings at once */
+	void*			m_cq_ring;
+
+	/** size of m_cq_ring */
+	size_t			m_cq_ring_size;
+
+	/** submission queue entries */
+	io_uring_sqe*		m_sqes;
+
+	/** size of m_sqes */
+	size_t			m_sqes_size;
+
+	/** submission queue head, advanced by the kernel */
+	unsigned*		m_sq_head;
+
+	/** submission queue tail, advanced by us */
+	unsigned*		m_sq_tail;
+
+	/** mask of submission queue indexes */
+	unsigned		m_sq_mask;
+
+	/** number of submission queue entries */
+	unsigned		m_sq_entries;
+
+	/** completion queue head, advanced by us */
+	unsigned*		m_cq_head;
+
+	/** completion queue tail, advanced by the kernel */
+	unsigned*		m_cq_tail;
+
+	/** mask of completion queue indexes */
+	unsigned		m_cq_mask;
+
+	/** completion queue entries */
+	io_uring_cqe*		m_cqes;
+
+	/** number of queued requests that were not submitted yet;
+	protected by m_sq_mutex */
+	unsigned		m_n_queued;
+
+	/** registered buffers, ordered by address;
+	protected by m_sq_mutex */
+	Buffers			m_bufs;
+
+	/** mutex protecting the submission queue */
+	OSMutex			m_sq_mutex;
+
+	/** mutex protecting the completion queue */
+	OSMutex			m_cq_mutex;
+};
+
+/** Set up the ring.
+@param[in]	entries	minimum number of submission queue entries
+@return whether the ring was set up; errno is set on failure */
+bool
+IOURing::create(ulint entries)
+{
+	io_uring_params	params;
+
+	memset(&params, 0, sizeof params);
+
+	m_fd = static_cast<int>(syscall(
+		__NR_io_uring_setup, static_cast<unsigned>(entries),
+		&params));
+
+	if (m_fd < 0) {
+		return(false);
+	}
+
+	m_sq_ring_size = params.sq_off.array
+		+ params.sq_entries * sizeof(unsigned);
+	m_cq_ring_size = params.cq_off.cqes
+		+ params.cq_entries * sizeof(io_uring_cqe);
+	m_sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+
+#ifdef IORING_FEAT_SINGLE_MMAP
+	if (params.features & IORING_FEAT_SINGLE_MMAP) {
+		m_sq_ring_size = m_cq_ring_size = std::max(
+			m_sq_ring_size, m_cq_ring_size);
+	}
+#endif /* IORING_FEAT_SINGLE_MMAP */
+
+	m_sq_ring = mmap(NULL, m_sq_ring_size, PROT_READ | PROT_WRITE,
+			 MAP_SHARED | MAP_POPULATE, m_fd, IORING_OFF_SQ_RING);
+
+	if (m_sq_ring == MAP_FAILED) {
+		return(false);
+	}
+
+#ifdef IORING_FEAT_SINGLE_MMAP
+	if (params.features & IORING_FEAT_SINGLE_MMAP) {
+		m_cq_ring = m_sq_ring;
+	} else
+#endif /* IORING_FEAT_SINGLE_MMAP */
+	{
+		m_cq_ring = mmap(NULL, m_cq_ring_size, PROT_READ | PROT_WRITE,
+				 MAP_SHARED | MAP_POPULATE, m_fd,
+				 IORING_OFF_CQ_RING);
+
+		if (m_cq_ring == MAP_FAILED) {
+			return(false);
+		}
+	}
+
+	m_sqes = static_cast<io_uring_sqe*>(
+		mmap(NULL, m_sqes_size, PROT_READ | PROT_WRITE,
+		     MAP_SHARED | MAP_POPULATE, m_fd, IORING_OFF_SQES));
+
+	if (m_sqes == MAP_FAILED) {
+		return(false);
+	}
+
+	byte*	sq = static_cast<byte*>(m_sq_ring);
+	byte*	cq = static_cast<byte*>(m_cq_ring);
+
+	m_sq_head = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+	m_sq_tail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+	m_sq_mask = *reinterpret_cast<unsigned*>(
+		sq + params.sq_off.ring_mask);
+	m_sq_entries = params.sq_entries;
+
+	m_cq_head = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+	m_cq_tail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+	m_cq_mask = *reinterpret_cast<unsigned*>(
+		cq + params.cq_off.ring_mask);
+	m_cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+
+	/* Submission queue entry i is always in array position i. */
+	unsigned*	array = reinterpret_cast<unsigned*>(
+		sq + params.sq_off.array);
+
+	for (unsigned i = 0; i < m_sq_entries; ++i) {
+		array[i] = i;
+	}
+
+	return(true);
+}
+
+/** Submit the queued requests, retrying on a temporary shortage of
+resources. The caller must hold m_sq_mutex. */
+void
+IOURing::submit_low()
+{
+	while (m_n_queued > 0) {
+
+		int	ret = static_cast<int>(syscall(
+			__NR_io_uring_enter, m_fd, m_n_queued, 0, 0,
+			NULL, 0));
+
+		if (ret > 0) {
+			ut_a(static_cast<unsigned>(ret) <= m_n_queued);
+			m_n_queued -= static_cast<unsigned>(ret);
+			continue;
+		}
+
+		switch (ret < 0 ? errno : 0) {
+		case EINTR:
+			continue;
+		case EAGAIN:
+		case EBUSY:
+		case ENOMEM:
+			/* Not enough resources! Try again. The requests
+			are already in the submission queue, and they
+			cannot be taken back. */
+			os_thread_sleep(1000);
+			continue;
+		}
+
+		ib::fatal()
+			<< "io_uring_enter() returned " << ret
+			<< " for " << m_n_queued << " requests, errno "
+			<< errno;
+	}
+}
+
+/** Add a request to the submission queue.
+@param[in,out]	slot	an already reserved slot
+@param[in]	submit	whether to submit the request now, instead
+			of leaving it to a later submit() */
+void
+IOURing::queue(Slot* slot, bool submit)
+{
+	m_sq_mutex.enter();
+
+	/* Only we advance the tail. */
+	unsigned	tail = *m_sq_tail;
+
+	if (tail - static_cast<unsigned>(my_atomic_load32_explicit(
+		    reinterpret_cast<int32*>(m_sq_head),
+		    MY_MEMORY_ORDER_ACQUIRE)) == m_sq_entries) {
+
+		submit_low();
+	}
+
+	io_uring_sqe*	sqe = &m_sqes[tail & m_sq_mask];
+	const bool	read = slot->type.is_read();
+	const int	index = find_buffer(slot->ptr, slot->len);
+
+	memset(sqe, 0, sizeof *sqe);
+
+	sqe->fd = slot->file;
+	sqe->off = slot->offset;
+	sqe->user_data = reinterpret_cast<uintptr_t>(slot);
+
+	if (index >= 0) {
+		sqe->opcode = read
+			? IORING_OP_READ_FIXED : IORING_OP_WRITE_FIXED;
+		sqe->addr = reinterpret_cast<uintptr_t>(slot->ptr);
+		sqe->len = static_cast<unsigned>(slot->len);
+		sqe->buf_index = static_cast<uint16_t>(index);
+	} else {
+		slot->iov.iov_base = slot->ptr;
+		slot->iov.iov_len = slot->len;
+
+		sqe->opcode = read ? IORING_OP_READV : IORING_OP_WRITEV;
+		sqe->addr = reinterpret_cast<uintptr_t>(&slot->iov);
+		sqe->len = 1;
+	}
+
+	my_atomic_store32_explicit(
+		reinterpret_cast<int32*>(m_sq_tail),
+		static_cast<int32>(tail + 1), MY_MEMORY_ORDER_RELEASE);
+
+	++m_n_queued;
+
+	if (submit) {
+		submit_low();
+	}
+
+	m_sq_mutex.exit();
+}
+
+/** Remove a completed request from the completion queue.
+@param[out]	res	number of bytes read or written,
+			or a negative error code
+@return the slot of the completed request, or NULL if none */
+Slot*
+IOURing::reap(ssize_t* res)
+{
+	Slot*	slot = NULL;
+
+	m_cq_mutex.enter();
+
+	/* Only we advance the head. */
+	unsigned	head = *m_cq_head;
+
+	if (head != static_cast<unsigned>(my_atomic_load32_explicit(
+		    reinterpret_cast<int32*>(m_cq_tail),
+		    MY_MEMORY_ORDER_ACQUIRE))) {
+
+		const io_uring_cqe&	cqe = m_cqes[head & m_cq_mask];
+
+		slot = reinterpret_cast<Slot*>(cqe.user_data);
+		*res = cqe.res;
+
+		my_atomic_store32_explicit(
+			reinterpret_cast<int32*>(m_cq_head),
+			static_cast<int32>(head + 1),
+			MY_MEMORY_ORDER_RELEASE);
+	}
+
+	m_cq_mutex.exit();
+
+	return(slot);
+}
+
+/** Look up the registered buffer that contains a block.
+@param[in]	ptr	start of the block
+@param[in]	len	length of the block
+@return index of the registered buffer, or -1 if none */
+int
+IOURing::find_buffer(const byte* ptr, ulint len) const
+{
+	iovec	key;
+
+	key.iov_base = const_cast<byte*>(ptr);
+	key.iov_len = len;
+
+	Buffers::const_iterator	it = std::upper_bound(
+		m_bufs.begin(), m_bufs.end(), key, buffer_less);
+
+	if (it == m_bufs.begin()) {
+		return(-1);
+	}
+
+	--it;
+
+	const byte*	start = static_cast<const byte*>(it->iov_base);
+
+	return(ptr + len <= start + it->iov_len
+	       ? static_cast<int>(it - m_bufs.begin()) : -1);
+}
+
+/** Register buffers for fixed buffer I/O, replacing any previously
+registered buffers.
+@param[in]	bufs	buffers
+@param[in]	n	number of buffers
+@return whether the buffers were registered */
+bool
+IOURing::register_buffers(const iovec* bufs, ulint n)
+{
+	bool	success = true;
+
+	m_sq_mutex.enter();
+
+	/* Queued requests may refer to the old buffer indexes. */
+	submit_low();
+
+	if (!m_bufs.empty()) {
+		syscall(__NR_io_uring_register, m_fd,
+			IORING_UNREGISTER_BUFFERS, NULL, 0);
+		m_bufs.clear();
+	}
+
+	for (ulint i = 0; i < n && m_bufs.size() < MAX_BUFFERS; ++i) {
+		if (bufs[i].iov_len <= MAX_BUFFER_SIZE) {
+			m_bufs.push_back(bufs[i]);
+		}
+	}
+
+	std::sort(m_bufs.begin(), m_bufs.end(), buffer_less);
+
+	if (!m_bufs.empty()
+	    && syscall(__NR_io_uring_register, m_fd,
+		       IORING_REGISTER_BUFFERS, &m_bufs[0],
+		       static_cast<unsigned>(m_bufs.size())) != 0) {
+
+		m_bufs.clear();
+		success = false;
+	}
+
+	m_sq_mutex.exit();
+
+	return(success);
+}
+#endif /* LINUX_IO_URING */
+
 #if defined(LINUX_NATIVE_AIO)
 
 /** Linux native AIO handler */
@@ -1670,6 +2203,15 @@ class LinuxAIOHandler {
 			&m_array, m_global_segment);
 
 		m_n_slots = m_array->slots_per_segment();
+		m_first_slot = m_n_slots * m_segment;
+
+		if (m_array->uring() != NULL) {
+			/* The segments share one io_uring, and any
+			I/O handler thread of the array can reap the
+			completion of any request of the array. */
+			m_n_slots *= m_array->get_n_segments();
+			m_first_slot = 0;
+		}
 	}
 
 	/** Destructor */
@@ -1724,13 +2266,30 @@ class LinuxAIOHandler {
 	each wakeup and that is why we use timed wait in io_getevents(). */
 	void collect();
 
+#ifdef LINUX_IO_URING
+	/** Collect completed requests from the io_uring of the array.
+	Called by collect(). */
+	void collect_uring();
+#endif /* LINUX_IO_URING */
+
+	/** Mark a request completed. The error handling will be done
+	in the calling function.
+	@param[in,out]	slot	the completed request
+	@param[in]	n_bytes	number of bytes read or written
+	@param[in]	ret	0 or a negative error code */
+	void complete(Slot* slot, ssize_t n_bytes, int ret);
+
 private:
 	/** Slot array */
 	AIO*			m_array;
 
-	/** Number of slots inthe local segment */
+	/** Number of slots inthe local segment, or in the whole
+	array if it uses io_uring */
 	ulint			m_n_slots;
 
+	/** The first slot to check */
+	ulint			m_first_slot;
+
 	/** The local segment to check */
 	ulint			m_segment;
 
@@ -1764,6 +2323,13 @@ LinuxAIOHandler::resubmit(Slot* slot)
 	slot->n_bytes = 0;
 	slot->io_already_done = false;
 
+	if (m_array->uring() != NULL) {
+		slot->type.clear_do_not_wake();
+
+		return(m_array->linux_dispatch(slot)
+		       ? DB_SUCCESS : DB_IO_PARTIAL_FAILED);
+	}
+
 	struct iocb*	iocb = &slot->control;
 
 	if (slot->type.is_read()) {
@@ -1847,13 +2413,11 @@ LinuxAIOHandler::check_state(Slot* slot)
 Slot*
 LinuxAIOHandler::find_completed_slot(ulint* n_pending)
 {
-	ulint	offset = m_n_slots * m_segment;
-
 	*n_pending = 0;
 
 	m_array->acquire();
 
-	Slot*	slot = m_array->at(offset);
+	Slot*	slot = m_array->at(m_first_slot);
 
 	for (ulint i = 0; i < m_n_slots; ++i, ++slot) {
 
@@ -1892,6 +2456,13 @@ LinuxAIOHandler::collect()
 	ut_ad(m_array != NULL);
 	ut_ad(m_segment < m_array->get_n_segments());
 
+#ifdef LINUX_IO_URING
+	if (m_array->uring() != NULL) {
+		collect_uring();
+		return;
+	}
+#endif /* LINUX_IO_URING */
+
 	/* Which io_context we are going to use. */
 	io_context*	io_ctx = m_array->io_ctx(m_segment);
 
@@ -1940,29 +2511,7 @@ LinuxAIOHandler::collect()
 			/* We have not overstepped to next segment. */
 			ut_a(slot->pos < end_pos);
 
-			/* Deallocate unused blocks from file system.
-			This is newer done to page 0 or to log files.*/
-			if (slot->offset > 0
-			    && !slot->type.is_log()
-			    && slot->type.is_write()
-			    && slot->type.punch_hole()) {
-
-				slot->err = slot->type.punch_hole(
-					slot->file,
-					slot->offset, slot->len);
-			} else {
-				slot->err = DB_SUCCESS;
-			}
-
-			/* Mark this request as completed. The error handling
-			will be done in the calling function. */
-			m_array->acquire();
-
-			slot->ret = events[i].res2;
-			slot->io_already_done = true;
-			slot->n_bytes = events[i].res;
-
-			m_array->release();
+			complete(slot, events[i].res, events[i].res2);
 		}
 
 		if (srv_shutdown_state == SRV_SHUTDOWN_EXIT_THREADS
@@ -2002,6 +2551,76 @@ LinuxAIOHandler::collect()
 	}
 }
 
+#ifdef LINUX_IO_URING
+/** Collect completed requests from the io_uring of the array.
+The requests that were queued with IORequest::DO_NOT_WAKE are submitted
+here at the latest, in case os_aio_simulated_wake_handler_threads()
+was not invoked. Like io_getevents() in collect(), we wait with a
+timeout so that the server status can be checked at each wakeup. */
+void
+LinuxAIOHandler::collect_uring()
+{
+	IOURing*	uring = m_array->uring();
+
+	for (bool waited = false;; waited = true) {
+		ulint	n = 0;
+		ssize_t	res;
+
+		uring->submit(false);
+
+		while (Slot* slot = uring->reap(&res)) {
+
+			ut_a(slot->is_reserved);
+
+			complete(slot, res < 0 ? 0 : res,
+				 res < 0 ? static_cast<int>(res) : 0);
+			++n;
+		}
+
+		if (n > 0
+		    || (waited
+			&& (srv_shutdown_state == SRV_SHUTDOWN_EXIT_THREADS
+			    || !buf_page_cleaner_is_active))) {
+
+			break;
+		}
+
+		uring->wait(OS_AIO_REAP_TIMEOUT / 1000000);
+	}
+}
+#endif /* LINUX_IO_URING */
+
+/** Mark a request completed. The error handling will be done in the
+calling function.
+@param[in,out]	slot	the completed request
+@param[in]	n_bytes	number of bytes read or written
+@param[in]	ret	0 or a negative error code */
+void
+LinuxAIOHandler::complete(Slot* slot, ssize_t n_bytes, int ret)
+{
+	/* Deallocate unused blocks from file system.
+	This is newer done to page 0 or to log files.*/
+	if (slot->offset > 0
+	    && !slot->type.is_log()
+	    && slot->type.is_write()
+	    && slot->type.punch_hole()) {
+
+		slot->err = slot->type.punch_hole(
+			slot->file,
+			slot->offset, slot->len);
+	} else {
+		slot->err = DB_SUCCESS;
+	}
+
+	m_array->acquire();
+
+	slot->ret = ret;
+	slot->io_already_done = true;
+	slot->n_bytes = n_bytes;
+
+	m_array->release();
+}
+
 /** Process a Linux AIO request
 @param[out]	m1		the messages passed with the
 @param[out]	m2		AIO request; note that in case the
@@ -2130,6 +2749,17 @@ AIO::linux_dispatch(Slot* slot)
 	ut_a(slot->is_reserved);
 	ut_ad(slot->type.validate());
 
+#ifdef LINUX_IO_URING
+	if (m_uring != NULL) {
+		/* A request that was posted with IORequest::DO_NOT_WAKE
+		will be submitted by os_aio_simulated_wake_handler_threads()
+		together with the rest of its batch. */
+		m_uring->queue(slot, slot->type.is_wake());
+
+		return(true);
+	}
+#endif /* LINUX_IO_URING */
+
 	/* Find out what we are going to work with.
 	The iocb struct is directly in the slot.
 	The io_context is one per segment. */
@@ -5689,6 +6319,9 @@ AIO::AIO(
 	,m_aio_ctx(),
 	m_events(m_slots.size())
 # endif /* LINUX_NATIVE_AIO */
+# ifdef LINUX_IO_URING
+	,m_uring()
+# endif /* LINUX_IO_URING */
 #ifdef WIN_ASYNC_IO
 	,m_completion_port(new_completion_port())
 #endif
@@ -5743,6 +6376,34 @@ AIO::init_slots()
 dberr_t
 AIO::init_linux_native_aio()
 {
+#ifdef LINUX_IO_URING
+	if (srv_use_io_uring) {
+		/* One io_uring for all segments of the array. Each
+		slot can have at most one request in the submission
+		queue at a time. */
+		ut_a(m_uring == NULL);
+
+		m_uring = UT_NEW_NOKEY(IOURing());
+
+		if (m_uring == NULL) {
+			return(DB_OUT_OF_MEMORY);
+		}
+
+		if (m_uring->create(m_slots.size())) {
+			return(DB_SUCCESS);
+		}
+
+		ib::warn()
+			<< "io_uring_setup() failed: " << strerror(errno)
+			<< ". Using libaio instead; try increasing"
+			" ulimit -l, or setting innodb_use_io_uring=0";
+
+		UT_DELETE(m_uring);
+		m_uring = NULL;
+		srv_use_io_uring = FALSE;
+	}
+#endif /* LINUX_IO_URING */
+
 	/* Initialize the io_context array. One io_context
 	per segment in the array. */
 
@@ -5858,6 +6519,9 @@ AIO::~AIO()
 		ut_free(m_aio_ctx);
 	}
 #endif /* LINUX_NATIVE_AIO */
+#ifdef LINUX_IO_URING
+	UT_DELETE(m_uring);
+#endif /* LINUX_IO_URING */
 #if defined(WIN_ASYNC_IO)
 	CloseHandle(m_completion_port);
 #endif
@@ -5885,6 +6549,23 @@ AIO::start(
 	ulint		n_slots_sync)
 {
 #if defined(LINUX_NATIVE_AIO)
+# ifdef LINUX_IO_URING
+	if (!srv_use_native_aio) {
+		srv_use_io_uring = FALSE;
+	} else if (srv_use_io_uring && !IOURing::is_supported()) {
+
+		ib::warn() << "io_uring is not available: " << strerror(errno)
+			<< ". Using libaio instead.";
+
+		srv_use_io_uring = FALSE;
+	}
+
+	if (srv_use_io_uring) {
+		/* io_uring does not depend on io_setup(), and it
+		works on tmpfs. */
+		ib::info() << "Using io_uring for asynchronous I/O";
+	} else
+# endif /* LINUX_IO_URING */
 	/* Check if native aio is supported on this system and tmpfs */
 	if (srv_use_native_aio && !is_linux_native_aio_supported()) {
 
@@ -6184,12 +6865,11 @@ AIO::reserve_slot(
 
 		release();
 
-		if (!srv_use_native_aio) {
-			/* If the handler threads are suspended,
-			wake them so that we get more slots */
+		/* If the handler threads are suspended, or the
+		requests are waiting in an io_uring submission queue,
+		wake them so that we get more slots */
 
-			os_aio_simulated_wake_handler_threads();
-		}
+		os_aio_simulated_wake_handler_threads();
 
 		os_event_wait(m_not_full);
 	}
@@ -6347,10 +7027,71 @@ AIO::wake_simulated_handler_thread(ulint global_segment, ulint segment)
 	release();
 }
 
-/** Wakes up simulated aio i/o-handler threads if they have something to do. */
+#ifdef LINUX_IO_URING
+/** Submit the io_uring requests that were queued with
+IORequest::DO_NOT_WAKE in any of the AIO arrays */
+void
+AIO::uring_submit_all()
+{
+	AIO*	arrays[] = { s_reads, s_writes, s_ibuf, s_log, s_sync };
+
+	for (ulint i = 0; i < array_elements(arrays); ++i) {
+		if (arrays[i] != NULL && arrays[i]->m_uring != NULL) {
+			arrays[i]->m_uring->submit(true);
+		}
+	}
+}
+
+/** Register the buffers of the read, write and ibuf arrays that can be
+used for io_uring fixed buffer I/O.
+@param[in]	bufs	buffers
+@param[in]	n	number of buffers */
+void
+AIO::uring_register_buffers(const iovec* bufs, ulint n)
+{
+	static bool	warned;
+
+	AIO*	arrays[] = { s_reads, s_writes, s_ibuf };
+
+	for (ulint i = 0; i < array_elements(arrays); ++i) {
+		if (arrays[i] == NULL || arrays[i]->m_uring == NULL
+		    || arrays[i]->m_uring->register_buffers(bufs, n)
+		    || warned) {
+			continue;
+		}
+
+		/* The requests will be submitted without
+		IORING_OP_READ_FIXED and IORING_OP_WRITE_FIXED. */
+		ib::warn() << "Could not register the buffer pool for"
+			" io_uring: " << strerror(errno)
+			<< ". Try increasing ulimit -l.";
+		warned = true;
+	}
+}
+
+/** Register the buffer pool memory for io_uring fixed buffer I/O.
+This is a no-op unless innodb_use_io_uring is in effect.
+@param[in]	bufs	memory chunks
+@param[in]	n	number of chunks */
+void
+os_aio_register_buffers(const iovec* bufs, ulint n)
+{
+	if (srv_use_io_uring) {
+		AIO::uring_register_buffers(bufs, n);
+	}
+}
+#endif /* LINUX_IO_URING */
+
+/** Wakes up simulated aio i/o-handler threads if they have something to do.
+With io_uring, submits the requests that were posted with
+IORequest::DO_NOT_WAKE. */
 void
 os_aio_simulated_wake_handler_threads()
 {
+#ifdef LINUX_IO_URING
+	AIO::uring_submit_all();
+#endif /* LINUX_IO_URING */
+
 	if (srv_use_native_aio) {
 		/* We do not use simulated aio: do nothing */
 
@@ -426,13 +426,19 @@ page_cur_search_with_match(
 		cur_matched_fields = std::min(low_matched_fields,
 					      up_matched_fields);
 
-		offsets = offsets_;
-		offsets = rec_get_offsets(
-			mid_rec, index, offsets, is_leaf,
-			dtuple_get_n_fields_cmp(tuple), &heap);
-
-		cmp = cmp_dtuple_rec_with_match(
-			tuple, mid_rec, offsets, &cur_matched_fields);
+		cmp = cmp_dtuple_rec_fixed(
+			tuple, mid_rec, index, &cur_matched_fields);
+
+		if (!cmp && cur_matched_fields
+		    < dtuple_get_n_fields_cmp(tuple)) {
+			offsets = offsets_;
+			offsets = rec_get_offsets(
+				mid_rec, index, offsets, is_leaf,
+				dtuple_get_n_fields_cmp(tuple), &heap);
+
+			cmp = cmp_dtuple_rec_with_match(
+				tuple, mid_rec, offsets, &cur_matched_fields);
+		}
 
 		if (cmp > 0) {
 low_slot_match:
@@ -480,13 +486,19 @@ page_cur_search_with_match(
 		cur_matched_fields = std::min(low_matched_fields,
 					      up_matched_fields);
 
-		offsets = offsets_;
-		offsets = rec_get_offsets(
-			mid_rec, index, offsets, is_leaf,
-			dtuple_get_n_fields_cmp(tuple), &heap);
+		cmp = cmp_dtuple_rec_fixed(
+			tuple, mid_rec, index, &cur_matched_fields);
 
-		cmp = cmp_dtuple_rec_with_match(
-			tuple, mid_rec, offsets, &cur_matched_fields);
+		if (!cmp && cur_matched_fields
+		    < dtuple_get_n_fields_cmp(tuple)) {
+			offsets = offsets_;
+			offsets = rec_get_offsets(
+				mid_rec, index, offsets, is_leaf,
+				dtuple_get_n_fields_cmp(tuple), &heap);
+
+			cmp = cmp_dtuple_rec_with_match(
+				tuple, mid_rec, offsets, &cur_matched_fields);
+		}
 
 		if (cmp > 0) {
 low_rec_match:
@@ -518,8 +530,8 @@ page_cur_search_with_match(
 
 				/* We got a match, but cur_matched_fields is
 				0, it must have REC_INFO_MIN_REC_FLAG */
-				ulint   rec_info = rec_get_info_bits(mid_rec,
-                                                     rec_offs_comp(offsets));
+				ulint   rec_info = rec_get_info_bits(
+					mid_rec, page_is_comp(page));
 				ut_ad(rec_info & REC_INFO_MIN_REC_FLAG);
 				ut_ad(!page_has_prev(page));
 				mtr_commit(&mtr);
@@ -182,6 +182,27 @@ will mark their views as closed but not actually free their views.
 */
 inline void ReadView::snapshot(trx_t *trx)
 {
+  UT_DELETE(m_csn_ids);
+  m_csn_ids= NULL;
+
+  if (trx && trx_sys.csn_enabled())
+  {
+    /*
+      The view sees all transactions that were committed in memory before
+      the commit sequence number is read. Transactions below
+      get_csn_clean_id() were committed before it was published, and
+      identifiers that are allocated after get_csn() was read are not
+      visible.
+    */
+    m_ids.clear();
+    m_up_limit_id= trx_sys.get_csn_clean_id();
+    m_csn= trx_sys.get_csn();
+    m_low_limit_id= m_low_limit_no= trx_sys.get_max_trx_id();
+    ut_ad(m_up_limit_id <= m_low_limit_id);
+    return;
+  }
+
+  m_csn= 0;
   trx_sys.snapshot_ids(trx, &m_ids, &m_low_limit_id, &m_low_limit_no);
   std::sort(m_ids.begin(), m_ids.end());
   m_up_limit_id= m_ids.empty() ? m_low_limit_id : m_ids.front();
@@ -236,7 +257,8 @@ void ReadView::open(trx_t *trx)
       well, since this view doesn't see it.
     */
     if (trx_is_autocommit_non_locking(trx) && m_ids.empty() &&
-        m_low_limit_id == trx_sys.get_max_trx_id())
+        m_low_limit_id == trx_sys.get_max_trx_id() &&
+        (!m_csn || m_csn == trx_sys.get_csn()))
       goto reopen;
 
     /*
@@ -269,6 +291,44 @@ void ReadView::open(trx_t *trx)
 }
 
 
+/**
+  Check whether the changes by id are visible to a view that consists of a
+  commit sequence number.
+
+  @param[in] id  transaction id, m_up_limit_id <= id < m_low_limit_id
+  @return whether the view sees the modifications of id
+*/
+bool ReadView::csn_changes_visible(trx_id_t id) const
+{
+  ut_ad(m_csn);
+  trx_id_t csn= trx_sys.csn_find(id);
+
+  if (!csn)
+  {
+    if (trx_sys.is_registered(current_trx(), id))
+      return false;
+
+    /* The transaction may have been committed after we looked. */
+    csn= trx_sys.csn_find(id);
+
+    if (!csn)
+    {
+      /*
+        The slot of the transaction was reused. Had that happened while the
+        transaction was invisible to this view, trx_sys_t::csn_evict() would
+        have attached the invisible transactions first.
+      */
+      if (const csn_view_ids_t *csn_ids= get_csn_ids())
+        return !std::binary_search(csn_ids->ids.begin(), csn_ids->ids.end(),
+                                   id);
+      return true;
+    }
+  }
+
+  return csn <= m_csn;
+}
+
+
 /**
   Clones the oldest view and stores it in view.
 
@@ -279,6 +339,11 @@ void ReadView::open(trx_t *trx)
 void trx_sys_t::clone_oldest_view()
 {
   purge_sys.view.snapshot(0);
+  if (csn_enabled())
+    my_atomic_store64(reinterpret_cast<int64*>(&m_csn_clean_id),
+                      int64(purge_sys.view.up_limit_id()));
+  /* Oldest commit sequence number view without attached transactions */
+  trx_id_t oldest_csn= TRX_ID_MAX;
   mutex_enter(&mutex);
   /* Find oldest view. */
   for (const trx_t *trx= UT_LIST_GET_FIRST(trx_list); trx;
@@ -290,7 +355,25 @@ void trx_sys_t::clone_oldest_view()
       ut_delay(1);
 
     if (state == READ_VIEW_STATE_OPEN)
+    {
       purge_sys.view.copy(trx->read_view);
+      if (trx_id_t csn= trx->read_view.csn())
+        if (csn < oldest_csn && !trx->read_view.get_csn_ids())
+          oldest_csn= csn;
+    }
+  }
+  if (oldest_csn != TRX_ID_MAX)
+  {
+    /*
+      The transactions that such views do not see were either active at
+      our snapshot, or they are in csn_log, because csn_evict() would have
+      attached them to the views before reusing their slots.
+    */
+    trx_ids_t ids;
+    trx_id_t min_no= TRX_ID_MAX;
+    csn_scan(oldest_csn, TRX_ID_MAX, &ids, &min_no);
+    std::sort(ids.begin(), ids.end());
+    purge_sys.view.merge(ids, TRX_ID_MAX, min_no);
   }
   mutex_exit(&mutex);
 }
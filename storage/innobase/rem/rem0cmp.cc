@@ -26,7 +26,6 @@ Created 7/1/1994 Heikki Tuuri
 #include "ha_prototypes.h"
 
 #include "rem0cmp.h"
-#include "handler0alter.h"
 #include "srv0srv.h"
 
 #include <gstream.h>
@@ -737,6 +736,220 @@ cmp_dtuple_rec_with_match_low(
 	return(ret);
 }
 
+/** Compare two fixed-length fields that are comparable with memcmp().
+@tparam	len	length of the fields in bytes
+@param[in]	data1	data field
+@param[in]	data2	data field
+@return the comparison result of data1 and data2 */
+template<ulint len>
+inline
+int
+cmp_fixed_field(const byte* data1, const byte* data2)
+{
+	return(memcmp(data1, data2, len));
+}
+
+/** Compare two INT fields. */
+template<>
+inline
+int
+cmp_fixed_field<4>(const byte* data1, const byte* data2)
+{
+	ulint	a = mach_read_from_4(data1);
+	ulint	b = mach_read_from_4(data2);
+
+	return(a < b ? -1 : a > b);
+}
+
+/** Compare two DB_ROW_ID fields. */
+template<>
+inline
+int
+cmp_fixed_field<DATA_ROW_ID_LEN>(const byte* data1, const byte* data2)
+{
+	ib_uint64_t	a = mach_read_from_6(data1);
+	ib_uint64_t	b = mach_read_from_6(data2);
+
+	return(a < b ? -1 : a > b);
+}
+
+/** Compare two BIGINT fields. */
+template<>
+inline
+int
+cmp_fixed_field<8>(const byte* data1, const byte* data2)
+{
+	ib_uint64_t	a = mach_read_from_8(data1);
+	ib_uint64_t	b = mach_read_from_8(data2);
+
+	return(a < b ? -1 : a > b);
+}
+
+/** Compare the leading fixed-length key fields of a data tuple and a
+ROW_FORMAT=COMPACT, DYNAMIC or COMPRESSED record. The fields are stored
+right at the record origin, so rec_get_offsets() is not needed.
+@tparam	len0	fixed length of the first field, or 0 if it is only
+known at runtime
+@param[in]	dtuple		data tuple
+@param[in]	rec		B-tree record
+@param[in]	index		B-tree index
+@param[in]	n_cmp		number of fields to compare
+@param[in,out]	matched_fields	number of completely matched fields
+@return the comparison result of dtuple and rec
+@retval 0 if the order was not resolved by the fixed-length fields */
+template<ulint len0>
+static
+int
+cmp_dtuple_rec_fixed_low(
+	const dtuple_t*		dtuple,
+	const rec_t*		rec,
+	const dict_index_t*	index,
+	ulint			n_cmp,
+	ulint*			matched_fields)
+{
+	const ulint	n_fixed	= std::min(n_cmp, ulint(index->n_cmp_fixed));
+	ulint		cur_field = *matched_fields;
+
+	ut_ad(dtuple_check_typed(dtuple));
+	ut_ad(dict_table_is_comp(index->table));
+	ut_ad(n_cmp <= dtuple_get_n_fields(dtuple));
+	ut_ad(cur_field <= n_cmp);
+	ut_ad(!len0 || len0 == dict_index_get_nth_field(index, 0)->fixed_len);
+
+	if (cur_field == 0) {
+		ulint	rec_info = rec_get_info_bits(rec, TRUE);
+		ulint	tup_info = dtuple_get_info_bits(dtuple);
+
+		if (UNIV_UNLIKELY(rec_info & REC_INFO_MIN_REC_FLAG)) {
+			return(!(tup_info & REC_INFO_MIN_REC_FLAG));
+		} else if (UNIV_UNLIKELY(tup_info & REC_INFO_MIN_REC_FLAG)) {
+			return(-1);
+		}
+
+		if (len0 && n_fixed) {
+			const dfield_t*	dtuple_field
+				= dtuple_get_nth_field(dtuple, 0);
+
+			if (dfield_get_len(dtuple_field) != len0) {
+				return(0);
+			}
+
+			if (int ret = cmp_fixed_field<len0>(
+				    static_cast<const byte*>(
+					    dfield_get_data(dtuple_field)),
+				    rec)) {
+				return(ret);
+			}
+
+			cur_field = 1;
+		}
+	}
+
+	ulint	i = len0 ? 1 : 0;
+
+	for (rec += len0; i < n_fixed; i++) {
+		const ulint	len
+			= dict_index_get_nth_field(index, i)->fixed_len;
+
+		if (i >= cur_field) {
+			const dfield_t*	dtuple_field
+				= dtuple_get_nth_field(dtuple, i);
+
+			if (dfield_get_len(dtuple_field) != len) {
+				break;
+			}
+
+			if (int ret = memcmp(dfield_get_data(dtuple_field),
+					     rec, len)) {
+				*matched_fields = i;
+				return(ret);
+			}
+		}
+
+		rec += len;
+	}
+
+	if (i > cur_field) {
+		cur_field = i;
+	}
+
+	*matched_fields = cur_field;
+	return(0);
+}
+
+/** Determine if a key field of an index is NOT NULL, of fixed length
+and comparable with memcmp().
+@param[in]	field	index field
+@return whether cmp_dtuple_rec_fixed() can compare the field */
+static
+bool
+cmp_field_is_fixed(const dict_field_t* field)
+{
+	const dict_col_t*	col = field->col;
+
+	if (!field->fixed_len || field->prefix_len
+	    || !(col->prtype & DATA_NOT_NULL)) {
+		return(false);
+	}
+
+	switch (col->mtype) {
+	case DATA_INT:
+	case DATA_SYS:
+	case DATA_FIXBINARY:
+		/* DATA_FIXBINARY fields of a non-binary collation
+		would be padded with 0x20, but fields of the same
+		length never are. */
+		return(true);
+	}
+
+	return(false);
+}
+
+/** Choose the comparator of the leading fixed-length key fields
+(dict_index_t::cmp_fixed) for an index that is being added to the cache.
+@param[in,out]	index	index */
+void
+cmp_index_init(dict_index_t* index)
+{
+	index->n_cmp_fixed = 0;
+	index->cmp_fixed = NULL;
+
+	if (!dict_table_is_comp(index->table)
+	    || dict_index_is_ibuf(index)
+	    || dict_index_is_spatial(index)) {
+		return;
+	}
+
+	const ulint	n_uniq = dict_index_get_n_unique_in_tree(index);
+	ulint		n;
+
+	for (n = 0; n < n_uniq; n++) {
+		if (!cmp_field_is_fixed(dict_index_get_nth_field(index, n))) {
+			break;
+		}
+	}
+
+	if (!n) {
+		return;
+	}
+
+	index->n_cmp_fixed = unsigned(n);
+
+	switch (dict_index_get_nth_field(index, 0)->fixed_len) {
+	case 4:
+		index->cmp_fixed = cmp_dtuple_rec_fixed_low<4>;
+		break;
+	case DATA_ROW_ID_LEN:
+		index->cmp_fixed = cmp_dtuple_rec_fixed_low<DATA_ROW_ID_LEN>;
+		break;
+	case 8:
+		index->cmp_fixed = cmp_dtuple_rec_fixed_low<8>;
+		break;
+	default:
+		index->cmp_fixed = cmp_dtuple_rec_fixed_low<0>;
+	}
+}
+
 /** Get the pad character code point for a type.
 @param[in]	type
 @return		pad character code point
@@ -1038,10 +1251,7 @@ cmp_rec_rec_simple(
 	const rec_t*		rec2,	/*!< in: physical record */
 	const ulint*		offsets1,/*!< in: rec_get_offsets(rec1, ...) */
 	const ulint*		offsets2,/*!< in: rec_get_offsets(rec2, ...) */
-	const dict_index_t*	index,	/*!< in: data dictionary index */
-	struct TABLE*		table)	/*!< in: MySQL table, for reporting
-					duplicate key value if applicable,
-					or NULL */
+	const dict_index_t*	index)	/*!< in: data dictionary index */
 {
 	ulint		n;
 	ulint		n_uniq	= dict_index_get_n_unique(index);
@@ -1075,9 +1285,7 @@ cmp_rec_rec_simple(
 	/* If we ran out of fields, the ordering columns of rec1 were
 	equal to rec2. Issue a duplicate key error if needed. */
 
-	if (!null_eq && table && dict_index_is_unique(index)) {
-		/* Report erroneous row using new version of table. */
-		innobase_rec_to_mysql(table, rec1, index, offsets1);
+	if (!null_eq && dict_index_is_unique(index)) {
 		return(0);
 	}
 
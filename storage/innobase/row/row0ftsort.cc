@@ -1409,7 +1409,7 @@ row_fts_sel_tree_propagate(
 	} else if (cmp_rec_rec_simple(mrec[child_left], mrec[child_right],
 				      offsets[child_left],
 				      offsets[child_right],
-				      index, NULL) < 0) {
+				      index) < 0) {
 		selected = child_left;
 	} else {
 		selected = child_right;
@@ -1497,7 +1497,7 @@ row_fts_build_sel_tree_level(
 		int cmp = cmp_rec_rec_simple(
 			mrec[child_left], mrec[child_right],
 			offsets[child_left], offsets[child_right],
-			index, NULL);
+			index);
 
 		sel_tree[start + i] = cmp < 0 ? child_left : child_right;
 	}
@@ -1768,7 +1768,7 @@ row_fts_merge_insert(
 				if (cmp_rec_rec_simple(
 					    mrec[i], mrec[min_rec],
 					    offsets[i], offsets[min_rec],
-					    index, NULL) < 0) {
+					    index) < 0) {
 					min_rec = static_cast<int>(i);
 				}
 			}
@@ -89,6 +89,7 @@ ins_node_create(
 
 	node->trx_id = 0;
 	node->duplicate = NULL;
+	node->bulk = false;
 
 	node->entry_sys_heap = mem_heap_create(128);
 
@@ -3773,6 +3774,14 @@ row_ins(
 			"row_ins_skip_sec",
 			node->index = NULL; node->entry = NULL; break;);
 
+		if (node->bulk) {
+			/* The secondary indexes will be built from the
+			clustered index at the end of the statement. */
+			node->index = NULL;
+			node->entry = NULL;
+			break;
+		}
+
 		/* Skip corrupted secondary index and its entry */
 		while (node->index && dict_index_is_corrupted(node->index)) {
 
@@ -2173,8 +2173,14 @@ row_merge_read_clustered_index(
 
 			If we are rebuilding the table, the
 			DB_TRX_ID,DB_ROLL_PTR should be reset, because
-			there will be no history available. */
-			ut_ad(rec_get_trx_id(rec, clust_index) < trx->id);
+			there will be no history available.
+
+			In row_merge_bulk_build(), the records were
+			inserted by the current transaction. */
+			ut_ad(rec_get_trx_id(rec, clust_index) < trx->id
+			      || (old_table == new_table
+				  && rec_get_trx_id(rec, clust_index)
+				  == trx->id));
 			rec_trx_id = 0;
 		}
 
@@ -2866,7 +2872,7 @@ row_merge_read_clustered_index(
 		/* Sync fts cache for other fts indexes to keep all
 		fts indexes consistent in sync_doc_id. */
 		err = fts_sync_table(const_cast<dict_table_t*>(new_table),
-				     false, true, false);
+				     true, false);
 
 		if (err == DB_SUCCESS) {
 			fts_update_next_doc_id(
@@ -2889,6 +2895,34 @@ row_merge_read_clustered_index(
 	DBUG_RETURN(err);
 }
 
+/** Copy a merge record that is a duplicate in a unique index to the
+MySQL table, for reporting the duplicate key value.
+@param[in]	dup	descriptor of index being created
+@param[in]	mrec	merge record
+@param[in]	offsets	offsets of mrec
+@param[in,out]	heap	memory heap */
+static
+void
+row_merge_dup_report_mrec(
+	const row_merge_dup_t*	dup,
+	const mrec_t*		mrec,
+	const ulint*		offsets,
+	mem_heap_t*		heap)
+{
+	const ulint	n_fields = rec_offs_n_fields(offsets);
+	dfield_t*	fields = static_cast<dfield_t*>(
+		mem_heap_alloc(heap, n_fields * sizeof *fields));
+
+	for (ulint i = 0; i < n_fields; i++) {
+		ulint		len;
+		const byte*	data = rec_get_nth_field(mrec, offsets, i, &len);
+
+		dfield_set_data(&fields[i], data, len);
+	}
+
+	innobase_fields_to_mysql(dup->table, dup->index, fields);
+}
+
 /** Write a record via buffer 2 and read the next record to buffer N.
 @param N number of the buffer (0 or 1)
 @param INDEX record descriptor
@@ -3017,13 +3051,16 @@ row_merge_blocks(
 
 	while (mrec0 && mrec1) {
 		int cmp = cmp_rec_rec_simple(
-			mrec0, mrec1, offsets0, offsets1,
-			dup->index, dup->table);
+			mrec0, mrec1, offsets0, offsets1, dup->index);
 		if (cmp < 0) {
 			ROW_MERGE_WRITE_GET_NEXT(0, dup->index, goto merged);
 		} else if (cmp) {
 			ROW_MERGE_WRITE_GET_NEXT(1, dup->index, goto merged);
 		} else {
+			if (dup->table != NULL) {
+				row_merge_dup_report_mrec(
+					dup, mrec0, offsets0, heap);
+			}
 			mem_heap_free(heap);
 			DBUG_RETURN(DB_DUPLICATE_KEY);
 		}
@@ -3292,6 +3329,300 @@ row_merge(
 	return(DB_SUCCESS);
 }
 
+/** A merge pass that is shared by several threads */
+struct row_merge_pass_t {
+	trx_t*			trx;		/*!< transaction */
+	const row_merge_dup_t*	dup;		/*!< index being created,
+						without a table for reporting
+						duplicates */
+	const merge_file_t*	file;		/*!< input file */
+	pfs_os_file_t		out_fd;		/*!< output file */
+	const ulint*		in_offset;	/*!< first offset of each
+						input run, followed by
+						file->offset */
+	const ulint*		out_offset;	/*!< first offset of each
+						output run */
+	ulint			num_run;	/*!< number of input runs */
+	ulint			space;		/*!< tablespace ID for
+						encryption */
+	ulint			next;		/*!< next output run to
+						produce; updated atomically */
+	ulint			n_rec;		/*!< number of records
+						written; updated atomically */
+};
+
+/** A thread helping row_merge_parallel() */
+struct row_merge_helper_t {
+	row_merge_pass_t*	pass;		/*!< the merge pass */
+	row_merge_block_t*	block;		/*!< 3 buffers */
+	ut_new_pfx_t		block_pfx;	/*!< for freeing block */
+	row_merge_block_t*	crypt_block;	/*!< encryption buffer,
+						or NULL */
+	ut_new_pfx_t		crypt_pfx;	/*!< for freeing crypt_block */
+	dberr_t			error;		/*!< outcome */
+	ulint			failed;		/*!< output run that
+						failed, or ULINT_UNDEFINED */
+	os_thread_id_t		thread;		/*!< the thread */
+};
+
+/** Produce output runs of a merge pass until none are left.
+@param[in,out]	pass		merge pass
+@param[in,out]	block		3 buffers
+@param[in,out]	crypt_block	encryption buffer, or NULL
+@param[in,out]	stage		performance schema accounting object,
+				or NULL
+@param[out]	failed		output run that failed
+@return DB_SUCCESS or error code */
+static
+dberr_t
+row_merge_pass_run(
+	row_merge_pass_t*	pass,
+	row_merge_block_t*	block,
+	row_merge_block_t*	crypt_block,
+	ut_stage_alter_t*	stage,
+	ulint*			failed)
+{
+	const ulint	half = pass->num_run / 2;
+	const ulint	n_out = pass->num_run - half;
+
+	for (;;) {
+		ulint	k = my_atomic_addlint(&pass->next, 1);
+
+		if (k >= n_out) {
+			return(DB_SUCCESS);
+		}
+
+		*failed = k;
+
+		if (trx_is_interrupted(pass->trx)) {
+			return(DB_INTERRUPTED);
+		}
+
+		merge_file_t	of;
+		ulint		foffs1 = pass->in_offset[half + k];
+
+		of.fd = pass->out_fd;
+		of.offset = pass->out_offset[k];
+		of.n_rec = 0;
+
+		if (k < half) {
+			ulint	foffs0 = pass->in_offset[k];
+			dberr_t	error = row_merge_blocks(
+				pass->dup, pass->file, block,
+				&foffs0, &foffs1, &of, stage,
+				crypt_block, pass->space);
+
+			if (error != DB_SUCCESS) {
+				return(error);
+			}
+		} else if (!row_merge_blocks_copy(
+				   pass->dup->index, pass->file, block,
+				   &foffs1, &of, stage,
+				   crypt_block, pass->space)) {
+			/* The odd run out of the second half is
+			copied, like in row_merge(). */
+			return(DB_CORRUPTION);
+		}
+
+		my_atomic_addlint(&pass->n_rec, ulint(of.n_rec));
+	}
+}
+
+/** Helper thread of row_merge_parallel().
+@param[in,out]	arg	row_merge_helper_t
+@return OS_THREAD_DUMMY_RETURN */
+static
+os_thread_ret_t
+DECLARE_THREAD(row_merge_helper_thread)(void* arg)
+{
+	row_merge_helper_t*	helper = static_cast<row_merge_helper_t*>(arg);
+
+	helper->error = row_merge_pass_run(
+		helper->pass, helper->block, helper->crypt_block, NULL,
+		&helper->failed);
+
+	os_thread_exit(false);
+
+	OS_THREAD_DUMMY_RETURN;
+}
+
+/** Merge disk files on several threads. Unlike in row_merge(), each output
+run is written where its input runs started, so that the output runs can be
+produced independently of each other. The file may thus contain unused
+blocks between runs; the runs are only accessed via run_offset[].
+@param[in]	trx		transaction
+@param[in]	dup		descriptor of index being created
+@param[in,out]	file		file containing index entries
+@param[in,out]	block		3 buffers
+@param[in,out]	tmpfd		temporary file handle
+@param[in,out]	num_run		Number of runs that remain to be merged
+@param[in,out]	run_offset	first offset of each run, followed by
+				file->offset
+@param[in,out]	stage		performance schema accounting object, used by
+ALTER TABLE. If not NULL stage->inc() will be called for each record
+processed by the calling thread.
+@param[in,out]	crypt_block	encryption buffer
+@param[in]	space		tablespace ID for encryption
+@param[in]	n_threads	maximum number of threads to use
+@return DB_SUCCESS or error code */
+static
+dberr_t
+row_merge_parallel(
+	trx_t*			trx,
+	const row_merge_dup_t*	dup,
+	merge_file_t*		file,
+	row_merge_block_t*	block,
+	pfs_os_file_t*		tmpfd,
+	ulint*			num_run,
+	ulint*			run_offset,
+	ut_stage_alter_t*	stage,
+	row_merge_block_t*	crypt_block,
+	ulint			space,
+	ulint			n_threads)
+{
+	const ulint	half = *num_run / 2;
+	const ulint	n_out = *num_run - half;
+	ulint*		out_offset = static_cast<ulint*>(
+		ut_malloc_nokey((n_out + 1) * sizeof *out_offset));
+	ulint		offset = 0;
+
+	ut_ad(run_offset[0] == 0);
+	ut_ad(run_offset[*num_run] == file->offset);
+
+	/* Output run k replaces input runs k and half + k. */
+	for (ulint k = 0; k < n_out; k++) {
+		out_offset[k] = offset;
+
+		if (k < half) {
+			offset += run_offset[k + 1] - run_offset[k];
+		}
+
+		offset += run_offset[half + k + 1] - run_offset[half + k];
+	}
+
+	ut_ad(offset == file->offset);
+	out_offset[n_out] = offset;
+
+	/* Duplicates are reported to the MySQL table after the pass,
+	by the calling thread. */
+	row_merge_dup_t		dup_no_table = *dup;
+	dup_no_table.table = NULL;
+
+	row_merge_pass_t	pass;
+
+	pass.trx = trx;
+	pass.dup = &dup_no_table;
+	pass.file = file;
+	pass.out_fd = *tmpfd;
+	pass.in_offset = run_offset;
+	pass.out_offset = out_offset;
+	pass.num_run = *num_run;
+	pass.space = space;
+	pass.next = 0;
+	pass.n_rec = 0;
+
+	const size_t		block_size = 3 * srv_sort_buf_size;
+	ut_allocator<row_merge_block_t>	alloc(mem_key_row_merge_sort);
+	ulint			n_helpers = std::min(n_threads, n_out) - 1;
+	row_merge_helper_t*	helpers = NULL;
+
+	if (n_helpers) {
+		helpers = static_cast<row_merge_helper_t*>(
+			ut_zalloc_nokey(n_helpers * sizeof *helpers));
+	}
+
+	for (ulint i = 0; i < n_helpers; i++) {
+		row_merge_helper_t*	helper = &helpers[i];
+
+		helper->pass = &pass;
+		helper->failed = ULINT_UNDEFINED;
+		helper->block = alloc.allocate_large(
+			block_size, &helper->block_pfx);
+
+		if (helper->block != NULL && crypt_block != NULL) {
+			helper->crypt_block = alloc.allocate_large(
+				block_size, &helper->crypt_pfx);
+
+			if (helper->crypt_block == NULL) {
+				alloc.deallocate_large(
+					helper->block, &helper->block_pfx,
+					block_size);
+				helper->block = NULL;
+			}
+		}
+
+		if (helper->block == NULL) {
+			/* Make do with the threads that we have. */
+			n_helpers = i;
+			break;
+		}
+
+		os_thread_create(row_merge_helper_thread, helper,
+				 &helper->thread);
+	}
+
+	ulint	failed = ULINT_UNDEFINED;
+	dberr_t	error = row_merge_pass_run(
+		&pass, block, crypt_block, stage, &failed);
+
+	for (ulint i = 0; i < n_helpers; i++) {
+		row_merge_helper_t*	helper = &helpers[i];
+
+		os_thread_join(helper->thread);
+
+		if (error == DB_SUCCESS) {
+			error = helper->error;
+			failed = helper->failed;
+		}
+
+		alloc.deallocate_large(helper->block, &helper->block_pfx,
+				       block_size);
+
+		if (helper->crypt_block != NULL) {
+			alloc.deallocate_large(helper->crypt_block,
+					       &helper->crypt_pfx,
+					       block_size);
+		}
+	}
+
+	ut_free(helpers);
+
+	if (error == DB_DUPLICATE_KEY && dup->table != NULL) {
+		/* Merge the runs again in order to report the
+		duplicate key value. */
+		merge_file_t	of;
+		ulint		foffs0 = run_offset[failed];
+		ulint		foffs1 = run_offset[half + failed];
+
+		ut_ad(failed < half);
+
+		of.fd = *tmpfd;
+		of.offset = out_offset[failed];
+		of.n_rec = 0;
+
+		error = row_merge_blocks(dup, file, block, &foffs0, &foffs1,
+					 &of, NULL, crypt_block, space);
+		ut_ad(error == DB_DUPLICATE_KEY);
+	}
+
+	if (error == DB_SUCCESS && pass.n_rec != file->n_rec) {
+		error = DB_CORRUPTION;
+	}
+
+	if (error == DB_SUCCESS) {
+		memcpy(run_offset, out_offset, (n_out + 1) * sizeof *run_offset);
+		*num_run = n_out;
+
+		/* Swap file descriptors for the next pass. */
+		*tmpfd = file->fd;
+		file->fd = pass.out_fd;
+	}
+
+	ut_free(out_offset);
+
+	return(error);
+}
+
 /** Merge disk files.
 @param[in]	trx	transaction
 @param[in]	dup	descriptor of index being created
@@ -3327,6 +3658,10 @@ row_merge_sort(
 	ulint		merge_count = 0;
 	ulint		total_merge_sort_count;
 	double		curr_progress = 0;
+	/* The full-text index runs are already being merged by
+	several threads. */
+	const ulint	n_threads = (dup->index->type & DICT_FTS)
+		? 1 : thd_sort_merge_threads(trx->mysql_thd);
 
 	DBUG_ENTER("row_merge_sort");
 
@@ -3349,12 +3684,21 @@ row_merge_sort(
 		DBUG_RETURN(error);
 	}
 
-	/* "run_offset" records each run's first offset number */
-	run_offset = (ulint*) ut_malloc_nokey(file->offset * sizeof(ulint));
+	/* "run_offset" records each run's first offset number,
+	followed by the end of the file */
+	run_offset = (ulint*) ut_malloc_nokey(
+		(file->offset + 1) * sizeof(ulint));
 
-	/* This tells row_merge() where to start for the first round
-	of merge. */
-	run_offset[half] = half;
+	if (n_threads > 1) {
+		/* Initially, each block is a run. */
+		for (ulint i = 0; i <= file->offset; i++) {
+			run_offset[i] = i;
+		}
+	} else {
+		/* This tells row_merge() where to start for the first
+		round of merge. */
+		run_offset[half] = half;
+	}
 
 	/* The file should always contain at least one byte (the end
 	of file marker).  Thus, it must be at least one block. */
@@ -3388,9 +3732,13 @@ row_merge_sort(
 		}
 #endif /* UNIV_SOLARIS */
 
-		error = row_merge(trx, dup, file, block, tmpfd,
-				  &num_runs, run_offset, stage,
-				  crypt_block, space);
+		error = n_threads > 1
+			? row_merge_parallel(trx, dup, file, block, tmpfd,
+					     &num_runs, run_offset, stage,
+					     crypt_block, space, n_threads)
+			: row_merge(trx, dup, file, block, tmpfd,
+				    &num_runs, run_offset, stage,
+				    crypt_block, space);
 
 		if(update_progress) {
 			merge_count++;
@@ -5092,3 +5440,72 @@ row_merge_build_indexes(
 
 	DBUG_RETURN(error);
 }
+
+/** Build the secondary indexes of a table from its clustered index,
+after rows were inserted into the empty table by row_bulk_insert_start().
+@param[in,out]	trx		transaction that inserted the rows
+@param[in,out]	table		table
+@param[in]	indexes		secondary indexes of the table
+@param[in]	key_numbers	MySQL key numbers
+@param[in]	n_indexes	size of indexes[]
+@param[in,out]	mysql_table	MySQL table, for reporting duplicate keys
+@return DB_SUCCESS or error code */
+dberr_t
+row_merge_bulk_build(
+	trx_t*			trx,
+	dict_table_t*		table,
+	dict_index_t**		indexes,
+	const ulint*		key_numbers,
+	ulint			n_indexes,
+	struct TABLE*		mysql_table)
+{
+	ib_sequence_t		sequence(NULL, 0, 0);
+	ut_stage_alter_t	stage(dict_table_get_first_index(table));
+
+	ut_ad(n_indexes > 0);
+	ut_ad(lock_table_has_locks(table));
+
+	for (ulint i = 0; i < n_indexes; i++) {
+		ut_ad(!dict_index_is_clust(indexes[i]));
+		ut_ad(indexes[i]->table == table);
+	}
+
+	/* The index pages will be written without redo logging. Unlike
+	in ALTER TABLE, the indexes are visible to crash recovery, which
+	would roll back the inserts from them if the server were killed
+	before all the pages have been written. Flag the indexes
+	corrupted in SYS_INDEXES until then, so that the rollback
+	will skip them and they will have to be rebuilt. */
+	for (ulint i = 0; i < n_indexes; i++) {
+		dict_index_write_corrupted(indexes[i], true);
+	}
+
+	DBUG_EXECUTE_IF("ib_bulk_build_crash_after_mark",
+			log_buffer_flush_to_disk();
+			DBUG_SUICIDE(););
+
+	dberr_t	error = row_merge_build_indexes(
+		trx, table, table, false, indexes, key_numbers, n_indexes,
+		mysql_table, NULL, NULL, ULINT_UNDEFINED, sequence, false,
+		&stage, NULL, NULL, false);
+
+	/* row_merge_build_indexes() freed the observer, but the
+	transaction will continue. */
+	trx_set_flush_observer(trx, NULL);
+
+	/* The FlushObserver either wrote the index pages, or
+	discarded them after an error, leaving the indexes empty. */
+	for (ulint i = 0; i < n_indexes; i++) {
+		dict_index_write_corrupted(indexes[i], false);
+	}
+
+	if (error == DB_SUCCESS) {
+		/* The index pages were written without redo logging;
+		let backup tools know that they must copy them. */
+		for (ulint i = 0; i < n_indexes; i++) {
+			row_merge_write_redo(indexes[i]);
+		}
+	}
+
+	return(error);
+}
@@ -1279,6 +1279,96 @@ row_lock_table(row_prebuilt_t* prebuilt)
 	return(err);
 }
 
+/** Determine if all indexes of a table are empty.
+@param[in]	table	table
+@return whether the table contains no records */
+static
+bool
+row_bulk_insert_is_empty(dict_table_t* table)
+{
+	for (dict_index_t* index = dict_table_get_first_index(table);
+	     index != NULL;
+	     index = dict_table_get_next_index(index)) {
+		mtr_t	mtr;
+
+		mtr.start();
+		mtr_s_lock(dict_index_get_lock(index), &mtr);
+
+		const buf_block_t*	root
+			= btr_root_block_get(index, RW_S_LATCH, &mtr);
+		const bool		empty
+			= root != NULL
+			&& page_is_leaf(root->frame)
+			&& !page_get_n_recs(root->frame);
+
+		mtr.commit();
+
+		if (!empty) {
+			return(false);
+		}
+	}
+
+	return(true);
+}
+
+/** Start inserting into an empty table without maintaining its secondary
+indexes (innodb_bulk_insert). The table will be locked exclusively, and
+the caller must build the secondary indexes with row_merge_bulk_build()
+at the end of the statement. Nothing will be done if the table is not
+empty or its indexes cannot be built in this way.
+@param[in,out]	prebuilt	table handle
+@return error code or DB_SUCCESS */
+dberr_t
+row_bulk_insert_start(row_prebuilt_t* prebuilt)
+{
+	dict_table_t*	table	= prebuilt->table;
+	trx_t*		trx	= prebuilt->trx;
+	dict_index_t*	clust_index = dict_table_get_first_index(table);
+
+	ut_ad(!prebuilt->bulk_trx_id);
+
+	if (dict_table_is_temporary(table)
+	    || table->no_rollback()
+	    || !table->is_readable()
+	    || dict_table_has_fts_index(table)
+	    || !table->foreign_set.empty()
+	    || !table->referenced_set.empty()
+	    || dict_index_is_online_ddl(clust_index)
+	    || !dict_table_get_next_index(clust_index)) {
+		return(DB_SUCCESS);
+	}
+
+	for (const dict_index_t* index = dict_table_get_next_index(
+		     clust_index);
+	     index != NULL;
+	     index = dict_table_get_next_index(index)) {
+		if ((index->type & (DICT_FTS | DICT_SPATIAL | DICT_CORRUPT))
+		    || dict_index_has_virtual(index)
+		    || !index->is_committed()
+		    || dict_index_is_online_ddl(index)) {
+			return(DB_SUCCESS);
+		}
+	}
+
+	if (!row_bulk_insert_is_empty(table)) {
+		return(DB_SUCCESS);
+	}
+
+	trx_start_if_not_started_xa(trx, true);
+
+	trx->op_info = "setting table lock";
+	dberr_t	err = lock_table_for_trx(table, trx, LOCK_X);
+	trx->op_info = "";
+
+	/* Other transactions may have inserted rows before we got
+	the lock. */
+	if (err == DB_SUCCESS && row_bulk_insert_is_empty(table)) {
+		prebuilt->bulk_trx_id = trx->id;
+	}
+
+	return(err);
+}
+
 /** Determine is tablespace encrypted but decryption failed, is table corrupted
 or is tablespace .ibd file missing.
 @param[in]	table		Table
@@ -1405,6 +1495,7 @@ row_insert_for_mysql(
 
 	row_get_prebuilt_insert_row(prebuilt);
 	node = prebuilt->ins_node;
+	node->bulk = prebuilt->bulk_trx_id && prebuilt->bulk_trx_id == trx->id;
 
 	row_mysql_convert_row_to_innobase(node->row, prebuilt, mysql_rec,
 					  &blob_heap);
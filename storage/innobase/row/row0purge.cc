@@ -393,6 +393,124 @@ row_purge_remove_sec_if_poss_tree(
 	return(success);
 }
 
+/** Try to position a cursor on the secondary index leaf page on which
+the last purge operation on the index was performed, without searching
+the index from the root.
+@param[in,out]	node	row purge node
+@param[in]	index	committed, non-spatial secondary index
+@param[in]	entry	index entry
+@param[out]	pcur	persistent cursor
+@param[in,out]	mtr	mini-transaction
+@param[out]	result	ROW_FOUND or ROW_NOT_FOUND, if true was returned
+@return whether the entry belongs to the guessed page, and pcur is
+positioned on it with the page X-latched */
+static MY_ATTRIBUTE((nonnull, warn_unused_result))
+bool
+row_purge_sec_leaf_guess(
+	purge_node_t*		node,
+	dict_index_t*		index,
+	const dtuple_t*		entry,
+	btr_pcur_t*		pcur,
+	mtr_t*			mtr,
+	enum row_search_result*	result)
+{
+	const purge_node_t::leaf_guess_t& guess = node->leaf_guess[
+		index->id % UT_ARR_SIZE(node->leaf_guess)];
+
+	if (guess.index_id != index->id
+	    || buf_pool_is_obsolete(guess.withdraw_clock)) {
+		return(false);
+	}
+
+	buf_block_t*	block = guess.block;
+	const ulint	savepoint = mtr_set_savepoint(mtr);
+
+	/* The modify_clock changes whenever a record is removed from
+	the page or the block is evicted. Insertions do not change it,
+	but they cannot make the page wrong for any key that is still
+	in its range. */
+	if (!buf_page_optimistic_get(RW_X_LATCH, block, guess.modify_clock,
+				     __FILE__, __LINE__, mtr)) {
+		return(false);
+	}
+
+	const page_t*	page = buf_block_get_frame(block);
+	bool		hit = false;
+
+	if (btr_page_get_index_id(page) == index->id
+	    && page_is_leaf(page) && page_get_n_recs(page) > 0) {
+		mem_heap_t*	heap = NULL;
+		ulint		offsets_[REC_OFFS_NORMAL_SIZE];
+		ulint*		offsets = offsets_;
+		rec_offs_init(offsets_);
+
+		const rec_t*	first = page_rec_get_next_const(
+			page_get_infimum_rec(page));
+		const rec_t*	last = page_rec_get_prev_const(
+			page_get_supremum_rec(page));
+
+		offsets = rec_get_offsets(first, index, offsets, true,
+					  ULINT_UNDEFINED, &heap);
+
+		if (cmp_dtuple_rec(entry, first, offsets) >= 0) {
+			offsets = rec_get_offsets(last, index, offsets, true,
+						  ULINT_UNDEFINED, &heap);
+			hit = cmp_dtuple_rec(entry, last, offsets) <= 0;
+		}
+
+		if (heap != NULL) {
+			mem_heap_free(heap);
+		}
+	}
+
+	if (!hit) {
+		mtr_release_block_at_savepoint(mtr, savepoint, block);
+		return(false);
+	}
+
+	ulint	up_match = 0;
+	ulint	low_match = 0;
+
+	btr_pcur_init(pcur);
+	pcur->btr_cur.index = index;
+	page_cur_search_with_match(block, index, entry, PAGE_CUR_LE,
+				   &up_match, &low_match,
+				   btr_pcur_get_page_cur(pcur), NULL);
+	pcur->btr_cur.low_match = low_match;
+	pcur->btr_cur.up_match = up_match;
+	pcur->btr_cur.flag = BTR_CUR_BINARY;
+	pcur->search_mode = PAGE_CUR_LE;
+	pcur->latch_mode = BTR_MODIFY_LEAF;
+	pcur->pos_state = BTR_PCUR_IS_POSITIONED;
+	pcur->trx_if_known = NULL;
+
+	*result = low_match == dtuple_get_n_fields(entry)
+		? ROW_FOUND : ROW_NOT_FOUND;
+
+	return(true);
+}
+
+/** Remember the secondary index leaf page that a cursor is positioned
+on, for row_purge_sec_leaf_guess().
+@param[in,out]	node	row purge node
+@param[in]	pcur	persistent cursor positioned on an X-latched leaf */
+static
+void
+row_purge_sec_leaf_remember(purge_node_t* node, const btr_pcur_t* pcur)
+{
+	const dict_index_t*	index = pcur->index();
+	purge_node_t::leaf_guess_t& guess = node->leaf_guess[
+		index->id % UT_ARR_SIZE(node->leaf_guess)];
+	buf_block_t*		block = btr_pcur_get_block(pcur);
+
+	ut_ad(page_is_leaf(buf_block_get_frame(block)));
+
+	guess.index_id = index->id;
+	guess.block = block;
+	guess.modify_clock = buf_block_get_modify_clock(block);
+	guess.withdraw_clock = buf_withdraw_clock;
+}
+
 /***************************************************************
 Removes a secondary index entry without modifying the index tree,
 if possible.
@@ -463,8 +581,12 @@ row_purge_remove_sec_if_poss_leaf(
 			que_node_get_parent(node));
 	}
 
-	search_result = row_search_index_entry(
-		index, entry, mode, &pcur, &mtr);
+	if (mode != BTR_PURGE_LEAF
+	    || !row_purge_sec_leaf_guess(node, index, entry, &pcur, &mtr,
+					 &search_result)) {
+		search_result = row_search_index_entry(
+			index, entry, mode, &pcur, &mtr);
+	}
 
 	if (dict_index_is_spatial(index)) {
 		rw_lock_sx_unlock(dict_index_get_lock(index));
@@ -549,6 +671,12 @@ row_purge_remove_sec_if_poss_leaf(
 		/* The deletion was buffered. */
 	case ROW_NOT_FOUND:
 		/* The index entry does not exist, nothing to do. */
+		if (mode == BTR_PURGE_LEAF
+		    && (search_result == ROW_FOUND
+			|| search_result == ROW_NOT_FOUND)) {
+			row_purge_sec_leaf_remember(node, &pcur);
+		}
+
 		btr_pcur_close(&pcur);
 func_exit_no_pcur:
 		mtr_commit(&mtr);
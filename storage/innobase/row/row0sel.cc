@@ -4140,6 +4140,26 @@ bool row_search_with_covering_prefix(
 	return true;
 }
 
+/** Read ahead the leaf pages of an ascending scan that has just moved
+to the next page, if the scan has reached the page where the previous
+read-ahead batch asked to be continued.
+@param[in,out]	prebuilt	prebuilt struct whose pcur has just been
+				moved to the next page */
+static
+void
+row_sel_read_ahead(row_prebuilt_t* prebuilt)
+{
+	const ulint	page_no = btr_pcur_get_block(prebuilt->pcur)
+		->page.id.page_no();
+
+	if (prebuilt->read_ahead_trigger == FIL_NULL
+	    || prebuilt->read_ahead_trigger == page_no) {
+		prebuilt->read_ahead_trigger = btr_pcur_read_ahead(
+			prebuilt->pcur, &prebuilt->read_ahead_parent,
+			srv_range_read_ahead);
+	}
+}
+
 /** Searches for rows in the database using cursor.
 Function is mainly used for tables that are shared across connections and
 so it employs technique that can help re-construct the rows that
@@ -4557,6 +4577,14 @@ row_search_mvcc(
 
 	/* Open or restore index cursor position */
 
+	if (direction == 0) {
+		/* A new scan reads ahead only after it has crossed
+		a page boundary, so that short range scans and
+		lookups will not read any pages in vain. */
+		prebuilt->read_ahead_parent = FIL_NULL;
+		prebuilt->read_ahead_trigger = FIL_NULL;
+	}
+
 	if (UNIV_LIKELY(direction != 0)) {
 		if (spatial_search) {
 			/* R-Tree access does not need to do
@@ -5584,6 +5612,11 @@ row_search_mvcc(
 				search_tuple, mode, pcur, 0, &mtr);
 		} else {
 			move = btr_pcur_move_to_next(pcur, &mtr);
+
+			if (move && srv_range_read_ahead && !unique_search
+			    && btr_pcur_is_before_first_on_page(pcur)) {
+				row_sel_read_ahead(prebuilt);
+			}
 		}
 
 		if (!move) {
@@ -5879,6 +5912,469 @@ row_count_rtree_recs(
 	goto loop;
 }
 
+/** Key ranges of a clustered index that are counted on several threads */
+struct row_count_scan_t {
+	dict_index_t*		index;		/*!< clustered index */
+	trx_t*			trx;		/*!< transaction */
+	ReadView*		view;		/*!< read view, or NULL
+						for READ UNCOMMITTED */
+	const dtuple_t**	bounds;		/*!< sorted, distinct node
+						pointer keys that separate
+						the ranges */
+	ulint			n_bounds;	/*!< number of bounds */
+	ulint			next;		/*!< next range to count;
+						updated atomically */
+	ulint			n_rows;		/*!< number of rows counted;
+						updated atomically */
+};
+
+/** Number of threads helping row_count_clust_recs(), in all statements;
+at most innodb_parallel_read_max_threads */
+static int32	row_count_n_helpers;
+
+/** Reserve helper threads for row_count_clust_recs().
+@param[in]	n_wanted	wanted number of helpers
+@return number of helpers reserved, at most n_wanted */
+static
+ulint
+row_count_reserve_helpers(ulint n_wanted)
+{
+	int32	n = my_atomic_load32(&row_count_n_helpers);
+
+	for (;;) {
+		int32	max = int32(srv_parallel_read_max_threads);
+
+		if (n >= max) {
+			return(0);
+		}
+
+		int32	n_reserved = int32(std::min(n_wanted, ulint(max - n)));
+
+		if (my_atomic_cas32(&row_count_n_helpers, &n,
+				    n + n_reserved)) {
+			return(ulint(n_reserved));
+		}
+	}
+}
+
+/** A thread helping row_count_clust_recs() */
+struct row_count_helper_t {
+	row_count_scan_t*	scan;		/*!< the scan */
+	dberr_t			error;		/*!< outcome */
+	os_thread_id_t		thread;		/*!< the thread */
+};
+
+/** @return whether a node pointer key is less than another */
+static
+bool
+row_count_key_less(const dtuple_t* a, const dtuple_t* b)
+{
+	return(dtuple_coll_cmp(a, b) < 0);
+}
+
+/** @return whether node pointer keys are equal */
+static
+bool
+row_count_key_equal(const dtuple_t* a, const dtuple_t* b)
+{
+	return(!dtuple_coll_cmp(a, b));
+}
+
+/** Collect the node pointer keys of an upper level of the clustered index,
+descending until there are enough keys to keep the threads busy. The index
+tree is not latched as a whole, so the pages may be modified or freed in the
+meantime; any keys will do, because the ranges only have to be disjoint.
+@param[in]	index		clustered index
+@param[in]	n_wanted	wanted number of ranges
+@param[in,out]	heap		memory heap for the keys
+@param[out]	bounds		sorted, distinct keys
+@return DB_SUCCESS or error code */
+static
+dberr_t
+row_count_split(
+	dict_index_t*		index,
+	ulint			n_wanted,
+	mem_heap_t*		heap,
+	std::vector<const dtuple_t*, ut_allocator<const dtuple_t*> >&
+				bounds)
+{
+	typedef std::vector<ulint, ut_allocator<ulint> >	page_nos_t;
+
+	const ulint		n_fields
+		= dict_index_get_n_unique_in_tree_nonleaf(index);
+	const page_size_t	page_size(index->table->space->flags);
+	const ulint		comp = dict_table_is_comp(index->table);
+	page_nos_t		pages(1, index->page);
+	page_nos_t		children;
+	ulint			level = ULINT_UNDEFINED;
+	mem_heap_t*		offsets_heap = NULL;
+	ulint			offsets_[REC_OFFS_NORMAL_SIZE];
+	dberr_t			err = DB_SUCCESS;
+	rec_offs_init(offsets_);
+
+	for (;;) {
+		children.clear();
+		bounds.clear();
+
+		for (page_nos_t::const_iterator it = pages.begin();
+		     it != pages.end(); ++it) {
+			mtr_t	mtr;
+
+			mtr.start();
+
+			buf_block_t*	block = buf_page_get_gen(
+				page_id_t(index->table->space->id, *it),
+				page_size, RW_S_LATCH, NULL,
+				BUF_GET_POSSIBLY_FREED,
+				__FILE__, __LINE__, &mtr, &err);
+
+			if (err != DB_SUCCESS) {
+				mtr.commit();
+				goto func_exit;
+			}
+
+			const page_t*	page = buf_block_get_frame(block);
+
+			if (level == ULINT_UNDEFINED) {
+				level = btr_page_get_level(page);
+			}
+
+			/* Skip pages that were freed or reused. */
+			if (level == 0
+			    || !fil_page_index_page_check(page)
+			    || btr_page_get_index_id(page) != index->id
+			    || btr_page_get_level(page) != level) {
+				mtr.commit();
+				continue;
+			}
+
+			for (const rec_t* rec = page_rec_get_next_const(
+				     page_get_infimum_rec(page));
+			     !page_rec_is_supremum(rec);
+			     rec = page_rec_get_next_const(rec)) {
+				ulint*	offsets = rec_get_offsets(
+					rec, index, offsets_, false,
+					ULINT_UNDEFINED, &offsets_heap);
+
+				children.push_back(
+					btr_node_ptr_get_child_page_no(
+						rec, offsets));
+
+				if (rec_get_info_bits(rec, comp)
+				    & REC_INFO_MIN_REC_FLAG) {
+					continue;
+				}
+
+				dtuple_t*	key = dict_index_build_data_tuple(
+					rec, index, false, n_fields, heap);
+				key->info_bits = 0;
+				bounds.push_back(key);
+			}
+
+			mtr.commit();
+		}
+
+		if (level == ULINT_UNDEFINED || level <= 1
+		    || bounds.size() + 1 >= n_wanted) {
+			break;
+		}
+
+		pages.swap(children);
+		level--;
+	}
+
+	std::sort(bounds.begin(), bounds.end(), row_count_key_less);
+	bounds.erase(std::unique(bounds.begin(), bounds.end(),
+				 row_count_key_equal),
+		     bounds.end());
+func_exit:
+	if (offsets_heap != NULL) {
+		mem_heap_free(offsets_heap);
+	}
+
+	return(err);
+}
+
+/** Count the visible records in a key range of the clustered index.
+@param[in]	scan	the scan
+@param[in]	low	smallest key in the range, or NULL
+@param[in]	high	smallest key after the range, or NULL
+@param[out]	n_rows	number of visible records
+@return DB_SUCCESS or error code */
+static
+dberr_t
+row_count_range(
+	const row_count_scan_t*	scan,
+	const dtuple_t*		low,
+	const dtuple_t*		high,
+	ulint*			n_rows)
+{
+	dict_index_t*	index = scan->index;
+	const ulint	comp = dict_table_is_comp(index->table);
+	btr_pcur_t	pcur;
+	mtr_t		mtr;
+	mem_heap_t*	heap = mem_heap_create(256);
+	dberr_t		err = DB_SUCCESS;
+	ulint		offsets_[REC_OFFS_NORMAL_SIZE];
+	rec_offs_init(offsets_);
+
+	*n_rows = 0;
+
+	mtr.start();
+
+	if (low != NULL) {
+		btr_pcur_open(index, low, PAGE_CUR_GE, BTR_SEARCH_LEAF,
+			      &pcur, &mtr);
+	} else {
+		btr_pcur_open_at_index_side(
+			true, index, BTR_SEARCH_LEAF, &pcur, true, 0, &mtr);
+	}
+
+	for (;;) {
+		const rec_t*	rec = btr_pcur_get_rec(&pcur);
+
+		if (page_rec_is_supremum(rec)) {
+			btr_pcur_move_to_prev_on_page(&pcur);
+
+			if (btr_pcur_is_on_user_rec(&pcur)) {
+				/* Release the page latch between pages. */
+				btr_pcur_store_position(&pcur, &mtr);
+				mtr.commit();
+
+				if (trx_is_interrupted(scan->trx)) {
+					err = DB_INTERRUPTED;
+					goto func_exit;
+				}
+
+				mtr.start();
+				btr_pcur_restore_position(
+					BTR_SEARCH_LEAF, &pcur, &mtr);
+			}
+
+			if (!btr_pcur_move_to_next_user_rec(&pcur, &mtr)) {
+				break;
+			}
+
+			continue;
+		}
+
+		if (page_rec_is_infimum(rec)) {
+			if (!btr_pcur_move_to_next_user_rec(&pcur, &mtr)) {
+				break;
+			}
+
+			continue;
+		}
+
+		if (!rec_is_default_row(rec, index)) {
+			mem_heap_empty(heap);
+
+			ulint*	offsets = rec_get_offsets(
+				rec, index, offsets_, true,
+				ULINT_UNDEFINED, &heap);
+
+			if (high != NULL
+			    && cmp_dtuple_rec(high, rec, offsets) <= 0) {
+				break;
+			}
+
+			if (low != NULL
+			    && cmp_dtuple_rec(low, rec, offsets) > 0) {
+				/* The search may have ended up before
+				the range. */
+			} else if (scan->view == NULL
+				   || scan->view->changes_visible(
+					   row_get_rec_trx_id(
+						   rec, index, offsets),
+					   index->table->name)) {
+				*n_rows += !rec_get_deleted_flag(rec, comp);
+			} else {
+				rec_t*	old_vers;
+
+				err = row_vers_build_for_consistent_read(
+					rec, &mtr, index, &offsets,
+					scan->view, &heap, heap,
+					&old_vers, NULL);
+
+				if (err != DB_SUCCESS) {
+					break;
+				}
+
+				*n_rows += old_vers != NULL
+					&& !rec_get_deleted_flag(
+						old_vers, comp);
+			}
+		}
+
+		btr_pcur_move_to_next_on_page(&pcur);
+	}
+
+	mtr.commit();
+func_exit:
+	btr_pcur_close(&pcur);
+	mem_heap_free(heap);
+
+	return(err);
+}
+
+/** Count the ranges of a scan until none are left.
+@param[in,out]	scan	the scan
+@return DB_SUCCESS or error code */
+static
+dberr_t
+row_count_scan_run(row_count_scan_t* scan)
+{
+	for (;;) {
+		ulint	k = my_atomic_addlint(&scan->next, 1);
+
+		if (k > scan->n_bounds) {
+			return(DB_SUCCESS);
+		}
+
+		ulint	n_rows;
+		dberr_t	err = row_count_range(
+			scan, k ? scan->bounds[k - 1] : NULL,
+			k < scan->n_bounds ? scan->bounds[k] : NULL,
+			&n_rows);
+
+		if (err != DB_SUCCESS) {
+			/* Make the other threads stop. */
+			my_atomic_storelint(&scan->next, scan->n_bounds + 1);
+			return(err);
+		}
+
+		my_atomic_addlint(&scan->n_rows, n_rows);
+	}
+}
+
+/** Helper thread of row_count_clust_recs().
+@param[in,out]	arg	row_count_helper_t
+@return OS_THREAD_DUMMY_RETURN */
+static
+os_thread_ret_t
+DECLARE_THREAD(row_count_helper_thread)(void* arg)
+{
+	row_count_helper_t*	helper = static_cast<row_count_helper_t*>(arg);
+
+	helper->error = row_count_scan_run(helper->scan);
+
+	os_thread_exit(false);
+
+	OS_THREAD_DUMMY_RETURN;
+}
+
+/** Count the records of the clustered index that are visible to a
+consistent read, by splitting the index into key ranges at its upper levels
+and counting the ranges on several threads that share the read view of the
+transaction. The threads other than the caller are reserved from
+innodb_parallel_read_max_threads, so fewer may be used.
+@param[in,out]	prebuilt	prebuilt struct in MySQL handle
+@param[in]	n_threads	wanted number of threads, including the caller
+@param[out]	n_rows		number of visible records
+@return DB_SUCCESS or error code */
+dberr_t
+row_count_clust_recs(
+	row_prebuilt_t*	prebuilt,
+	ulint		n_threads,
+	ulint*		n_rows)
+{
+	trx_t*		trx = prebuilt->trx;
+	dict_index_t*	index = dict_table_get_first_index(prebuilt->table);
+
+	ut_ad(!prebuilt->table->is_temporary());
+	ut_ad(!prebuilt->table->no_rollback());
+	ut_ad(n_threads > 0);
+
+	*n_rows = 0;
+
+	if (prebuilt->select_lock_type != LOCK_NONE) {
+		/* Only a consistent read can be shared by the threads. */
+		return(DB_UNSUPPORTED);
+	}
+
+	if (!prebuilt->sql_stat_start) {
+		ut_ad(trx->read_view.is_open() || srv_read_only_mode);
+	} else {
+		/* Assign a read view for the statement, like
+		row_search_mvcc() does for a consistent read. */
+		trx_start_if_not_started(trx, false);
+
+		if (!srv_read_only_mode) {
+			trx->read_view.open(trx);
+		}
+
+		prebuilt->sql_stat_start = FALSE;
+	}
+
+	ulint		n_reserved = row_count_reserve_helpers(n_threads - 1);
+	mem_heap_t*	heap = mem_heap_create(1024);
+	std::vector<const dtuple_t*, ut_allocator<const dtuple_t*> >
+			bounds;
+
+	/* Make a few ranges per thread, so that the threads stay busy
+	even if some ranges are much bigger than others. */
+	dberr_t		err = n_reserved
+		? row_count_split(index, (n_reserved + 1) * 8, heap, bounds)
+		: DB_SUCCESS;
+
+	if (err != DB_SUCCESS) {
+		my_atomic_add32(&row_count_n_helpers, -int32(n_reserved));
+		mem_heap_free(heap);
+		return(err);
+	}
+
+	row_count_scan_t	scan;
+
+	scan.index = index;
+	scan.trx = trx;
+	scan.view = trx->isolation_level == TRX_ISO_READ_UNCOMMITTED
+		|| srv_read_only_mode
+		? NULL : &trx->read_view;
+	scan.bounds = bounds.empty() ? NULL : &bounds[0];
+	scan.n_bounds = bounds.size();
+	scan.next = 0;
+	scan.n_rows = 0;
+
+	ut_ad(!scan.view || scan.view->is_open());
+
+	const ulint		n_helpers = std::min(n_reserved, scan.n_bounds);
+	row_count_helper_t*	helpers = NULL;
+
+	/* Return the helpers that there are no ranges for. */
+	my_atomic_add32(&row_count_n_helpers, -int32(n_reserved - n_helpers));
+
+	if (n_helpers) {
+		helpers = static_cast<row_count_helper_t*>(
+			ut_zalloc_nokey(n_helpers * sizeof *helpers));
+	}
+
+	for (ulint i = 0; i < n_helpers; i++) {
+		helpers[i].scan = &scan;
+		os_thread_create(row_count_helper_thread, &helpers[i],
+				 &helpers[i].thread);
+	}
+
+	err = row_count_scan_run(&scan);
+
+	for (ulint i = 0; i < n_helpers; i++) {
+		os_thread_join(helpers[i].thread);
+
+		if (err == DB_SUCCESS) {
+			err = helpers[i].error;
+		}
+	}
+
+	my_atomic_add32(&row_count_n_helpers, -int32(n_helpers));
+	ut_free(helpers);
+	mem_heap_free(heap);
+
+	if (err == DB_SUCCESS) {
+		*n_rows = scan.n_rows;
+	}
+
+	return(err);
+}
+
 /*******************************************************************//**
 Checks if MySQL at the moment is allowed for this table to retrieve a
 consistent read result, or store it to the query cache.
@@ -472,6 +472,18 @@ static monitor_info_t	innodb_counter_info[] =
 	 MONITOR_NONE,
 	 MONITOR_DEFAULT_START, MONITOR_FLUSH_SYNC_WAITS},
 
+	{"buffer_flush_wasted_writes", "buffer",
+	 "Number of page writes after which the page was modified again"
+	 " within innodb_flush_hot_page_interval",
+	 MONITOR_NONE,
+	 MONITOR_DEFAULT_START, MONITOR_FLUSH_WASTED_WRITES},
+
+	{"buffer_flush_hot_pages_deferred", "buffer",
+	 "Number of frequently modified pages that adaptive flushing"
+	 " left for a later batch",
+	 MONITOR_NONE,
+	 MONITOR_DEFAULT_START, MONITOR_FLUSH_HOT_DEFERRED},
+
 	/* Cumulative counter for flush batches for adaptive flushing  */
 	{"buffer_flush_adaptive_total_pages", "buffer",
 	 "Total pages flushed as part of adaptive flushing",
@@ -792,6 +804,12 @@ static monitor_info_t	innodb_counter_info[] =
 	 MONITOR_NONE,
 	 MONITOR_DEFAULT_START, MONITOR_TRX_COMMIT_UNDO},
 
+	{"trx_commits_batched", "transaction",
+	 "Number of transactions whose commit was written by another"
+	 " transaction of the same rollback segment",
+	 MONITOR_NONE,
+	 MONITOR_DEFAULT_START, MONITOR_TRX_COMMIT_BATCHED},
+
 	{"trx_rollbacks", "transaction",
 	 "Number of transactions rolled back",
 	 MONITOR_NONE,
@@ -957,6 +975,12 @@ static monitor_info_t	innodb_counter_info[] =
 	 MONITOR_EXISTING | MONITOR_DEFAULT_ON),
 	 MONITOR_DEFAULT_START, MONITOR_OVLD_LOG_PADDED},
 
+	{"log_pending_copy_waits", "recovery",
+	 "Number of times the log buffer write waited for"
+	 " innodb_log_parallel_copy to finish",
+	 MONITOR_NONE,
+	 MONITOR_DEFAULT_START, MONITOR_LOG_PENDING_COPY_WAITS},
+
 	/* ========== Counters for Page Compression ========== */
 	{"module_compress", "compression", "Page Compression Info",
 	 MONITOR_MODULE,
@@ -138,6 +138,10 @@ it, truncate action is completed but no new tablespace is marked
 for truncate (action is never aborted). */
 my_bool	srv_undo_log_truncate;
 
+/** innodb_read_view_csn; whether read views of transactions consist of
+a commit sequence number instead of a list of active transactions */
+my_bool	srv_read_view_csn;
+
 /** Maximum size of undo tablespace. */
 unsigned long long	srv_max_undo_log_size;
 
@@ -169,6 +173,9 @@ OS (provided we compiled Innobase with it in), otherwise we will
 use simulated aio we build below with threads.
 Currently we support native aio on windows and linux */
 my_bool	srv_use_native_aio;
+/** innodb_use_io_uring: whether to use io_uring instead of libaio
+for the native aio on Linux */
+my_bool	srv_use_io_uring;
 my_bool	srv_numa_interleave;
 /** copy of innodb_use_atomic_writes; @see innobase_init() */
 my_bool	srv_use_atomic_writes;
@@ -201,6 +208,9 @@ ulong		srv_page_size;
 ulong		srv_page_size_shift;
 /** innodb_log_write_ahead_size */
 ulong		srv_log_write_ahead_size;
+/** innodb_log_parallel_copy; whether mini-transactions copy their redo
+log records to the log buffer after releasing log_sys->mutex */
+my_bool		srv_log_parallel_copy;
 
 page_size_t	univ_page_size(0, 0, false);
 
@@ -264,6 +274,16 @@ ulong	srv_idle_flush_pct;
 
 /** copy of innodb_read_io_threads */
 ulint	srv_n_read_io_threads;
+/** innodb_recovery_apply_threads; number of threads that apply the
+hashed redo log records to the pages during crash recovery */
+ulong	srv_n_recv_apply_threads = 1;
+/** innodb_tablespace_open_threads; number of threads that open the
+file-per-table tablespaces at startup */
+ulong	srv_n_tablespace_open_threads = 1;
+/** innodb_flush_hot_page_interval; a page that is modified again within
+this many milliseconds of being written is considered hot, and adaptive
+flushing prefers other pages to it; 0 disables this */
+ulong	srv_flush_hot_page_interval;
 /** copy of innodb_write_io_threads */
 ulint	srv_n_write_io_threads;
 
@@ -273,6 +293,9 @@ my_bool	srv_random_read_ahead;
 in the buffer cache and accessed sequentially for InnoDB to trigger a
 readahead request. */
 ulong	srv_read_ahead_threshold;
+/** innodb_range_read_ahead; the number of leaf pages ahead of an ascending
+index range scan that are read asynchronously, or 0 to disable */
+ulong	srv_range_read_ahead;
 
 /** innodb_change_buffer_max_size; maximum on-disk size of change
 buffer in terms of percentage of the buffer pool. */
@@ -319,6 +342,10 @@ ulong	srv_n_purge_threads;
 /** innodb_purge_batch_size, in pages */
 ulong	srv_purge_batch_size;
 
+/** innodb_parallel_read_max_threads; the number of threads that may help
+all the SELECT COUNT(*) statements together */
+ulong	srv_parallel_read_max_threads;
+
 /** innodb_stats_method decides how InnoDB treats
 NULL value when collecting statistics. By default, it is set to
 SRV_STATS_NULLS_EQUAL(0), ie. all NULL value are treated equal */
@@ -389,6 +416,11 @@ number of pages to use in LRU and flush_list batch flushing.
 The rest of the doublewrite buffer is used for single-page flushing. */
 ulong	srv_doublewrite_batch_size = 120;
 
+/** innodb_doublewrite_file_pages: if nonzero, the size of the
+per-buffer-pool-instance doublewrite files that are used for LRU and
+flush_list batch flushing instead of the system tablespace */
+ulong	srv_doublewrite_file_pages;
+
 /** innodb_replication_delay */
 ulong	srv_replication_delay;
 
@@ -1541,6 +1573,21 @@ srv_export_innodb_status(void)
 
 	export_vars.innodb_log_waits = srv_stats.log_waits;
 
+	export_vars.innodb_log_checkpoint_waits =
+		srv_stats.log_checkpoint_waits;
+
+	export_vars.innodb_log_checkpoint_wait_time =
+		srv_stats.log_checkpoint_wait_time / 1000;
+
+	if (log_sys) {
+		log_mutex_enter();
+		export_vars.innodb_checkpoint_age =
+			log_sys->lsn - log_sys->last_checkpoint_lsn;
+		export_vars.innodb_checkpoint_max_age =
+			log_sys->max_checkpoint_age;
+		log_mutex_exit();
+	}
+
 	export_vars.innodb_os_log_written = srv_stats.os_log_written;
 
 	export_vars.innodb_os_log_fsyncs = fil_n_log_flushes;
@@ -1266,6 +1266,10 @@ srv_shutdown_all_bg_threads()
 			if (log_scrub_thread_active) {
 				os_event_set(log_scrub_event);
 			}
+
+			if (log_checkpointer_thread_active) {
+				os_event_set(log_checkpointer_event);
+			}
 		}
 
 		if (srv_start_state_is_set(SRV_START_STATE_IO)) {
@@ -1572,6 +1576,16 @@ innobase_start_or_create_for_mysql()
 	srv_use_native_aio = FALSE;
 #endif /* _WIN32 */
 
+#ifndef LINUX_IO_URING
+	if (srv_use_io_uring) {
+		ib::warn() << "innodb_use_io_uring is not supported"
+			" by this build; using "
+			<< (srv_use_native_aio ? "native" : "simulated")
+			<< " AIO";
+		srv_use_io_uring = FALSE;
+	}
+#endif /* !LINUX_IO_URING */
+
 	/* Register performance schema stages before any real work has been
 	started which may need to be instrumented. */
 	mysql_stage_register("innodb", srv_stages, UT_ARR_SIZE(srv_stages));
@@ -1637,6 +1651,7 @@ innobase_start_or_create_for_mysql()
 			    + srv_n_write_io_threads
 			    + srv_n_purge_threads
 			    + srv_n_page_cleaners
+			    + srv_n_recv_apply_threads
 			    /* FTS Parallel Sort */
 			    + fts_sort_pll_degree * FTS_NUM_AUX_INDEX
 			      * max_connections;
@@ -2193,7 +2208,7 @@ innobase_start_or_create_for_mysql()
 
 		err = recv_recovery_from_checkpoint_start(flushed_lsn);
 
-		recv_sys->dblwr.pages.clear();
+		recv_sys->dblwr.clear();
 
 		if (err != DB_SUCCESS) {
 			return(srv_init_abort(err));
@@ -2669,6 +2684,13 @@ innobase_start_or_create_for_mysql()
 	if (!srv_read_only_mode) {
 		/* wake main loop of page cleaner up */
 		os_event_set(buf_flush_event);
+
+		if (srv_operation == SRV_OPERATION_NORMAL) {
+			/* Create the thread that writes checkpoints
+			in the background. */
+			log_checkpointer_thread_active = true;
+			os_thread_create(log_checkpointer_thread, NULL, NULL);
+		}
 	}
 
 	if (srv_print_verbose_log) {
@@ -178,6 +178,7 @@ void purge_sys_t::create()
   rw_lock_create(trx_purge_latch_key, &latch, SYNC_PURGE_LATCH);
   mutex_create(LATCH_ID_PURGE_SYS_PQ, &pq_mutex);
   undo_trunc.create();
+  heap= mem_heap_create(srv_page_size);
   m_initialised = true;
 }
 
@@ -200,6 +201,7 @@ void purge_sys_t::close()
 	ut_ad(latch.magic_n == 0);
 	ut_d(latch.magic_n = RW_LOCK_MAGIC_N);
 	mutex_free(&pq_mutex);
+	mem_heap_free(heap);
 	os_event_destroy(event);
 }
 
@@ -1368,13 +1370,15 @@ trx_purge_attach_undo_recs(ulint n_purge_threads)
 	que_thr_t*	thr;
 	ulint		i = 0;
 	ulint		n_pages_handled = 0;
-	ulint		n_thrs = UT_LIST_GET_LEN(purge_sys.query->thrs);
+	purge_node_t*	nodes[32];
 
 	ut_a(n_purge_threads > 0);
+	ut_a(n_purge_threads <= UT_ARR_SIZE(nodes));
 
 	purge_sys.head = purge_sys.tail;
 
-	/* Debug code to validate some pre-requisites and reset done flag. */
+	/* Validate some pre-requisites, reset the done flag and collect
+	the purge nodes. */
 	for (thr = UT_LIST_GET_FIRST(purge_sys.query->thrs);
 	     thr != NULL && i < n_purge_threads;
 	     thr = UT_LIST_GET_NEXT(thrs, thr), ++i) {
@@ -1387,37 +1391,42 @@ trx_purge_attach_undo_recs(ulint n_purge_threads)
 		ut_a(que_node_get_type(node) == QUE_NODE_PURGE);
 		ut_a(node->undo_recs == NULL);
 		ut_a(node->done);
+		ut_a(!thr->is_active);
 
 		node->done = FALSE;
+		nodes[i] = node;
 	}
 
 	/* There should never be fewer nodes than threads, the inverse
 	however is allowed because we only use purge threads as needed. */
 	ut_a(i == n_purge_threads);
 
-	/* Fetch and parse the UNDO records. The UNDO records are added
-	to a per purge node vector. */
-	thr = UT_LIST_GET_FIRST(purge_sys.query->thrs);
-	ut_a(n_thrs > 0 && thr != NULL);
+	/* Fetch the UNDO records and add them to per purge node vectors.
+	All the records of a table are normally handed to the same purge
+	node, so that the purge threads will not contend for the same
+	index pages, and each purge node will find the secondary index
+	leaf pages that it modified last still in its cache. A table
+	moves on to the least loaded node if its node is getting more
+	than its share of the batch, so that purge remains parallel
+	when the history consists of a single table. */
+	typedef std::map<
+		table_id_t,
+		purge_node_t*,
+		std::less<table_id_t>,
+		ut_allocator<std::pair<const table_id_t, purge_node_t*> > >
+		table_node_map_t;
+
+	table_node_map_t	table_node;
+	ulint			n_recs = 0;
 
 	ut_ad(purge_sys.head <= purge_sys.tail);
 
-	i = 0;
+	mem_heap_empty(purge_sys.heap);
 
 	const ulint batch_size = srv_purge_batch_size;
 
 	for (;;) {
-		purge_node_t*		node;
-		trx_purge_rec_t*	purge_rec;
-
-		ut_a(!thr->is_active);
-
-		/* Get the purge node. */
-		node = (purge_node_t*) thr->child;
-		ut_a(que_node_get_type(node) == QUE_NODE_PURGE);
-
-		purge_rec = static_cast<trx_purge_rec_t*>(
-			mem_heap_zalloc(node->heap, sizeof(*purge_rec)));
+		trx_purge_rec_t	purge_rec;
 
 		/* Track the max {trx_id, undo_no} for truncating the
 		UNDO logs once we have purged the records. */
@@ -1427,37 +1436,70 @@ trx_purge_attach_undo_recs(ulint n_purge_threads)
 		}
 
 		/* Fetch the next record, and advance the purge_sys.tail. */
-		purge_rec->undo_rec = trx_purge_fetch_next_rec(
-			&purge_rec->roll_ptr, &n_pages_handled, node->heap);
-
-		if (purge_rec->undo_rec != NULL) {
-
-			if (node->undo_recs == NULL) {
-				node->undo_recs = ib_vector_create(
-					ib_heap_allocator_create(node->heap),
-					sizeof(trx_purge_rec_t),
-					batch_size);
-			} else {
-				ut_a(!ib_vector_is_empty(node->undo_recs));
-			}
+		purge_rec.undo_rec = trx_purge_fetch_next_rec(
+			&purge_rec.roll_ptr, &n_pages_handled,
+			purge_sys.heap);
 
-			ib_vector_push(node->undo_recs, purge_rec);
+		if (purge_rec.undo_rec == NULL) {
+			break;
+		}
 
-			if (n_pages_handled >= batch_size) {
+		purge_node_t*	node = NULL;
+		purge_node_t**	bound = NULL;
 
-				break;
+		if (purge_rec.undo_rec != &trx_purge_dummy_rec) {
+			ulint		type;
+			ulint		cmpl_info;
+			bool		updated_extern;
+			undo_no_t	undo_no;
+			table_id_t	table_id;
+
+			trx_undo_rec_get_pars(
+				purge_rec.undo_rec, &type, &cmpl_info,
+				&updated_extern, &undo_no, &table_id);
+
+			bound = &table_node[table_id];
+			node = *bound;
+		}
+
+		if (node == NULL
+		    || (node->undo_recs != NULL
+			&& ib_vector_size(node->undo_recs)
+			> n_recs / n_purge_threads + 64)) {
+
+			node = nodes[0];
+
+			for (i = 1; i < n_purge_threads; i++) {
+				if (nodes[i]->undo_recs == NULL) {
+					node = nodes[i];
+					break;
+				} else if (node->undo_recs != NULL
+					   && ib_vector_size(nodes[i]->undo_recs)
+					   < ib_vector_size(node->undo_recs)) {
+					node = nodes[i];
+				}
+			}
+
+			if (bound != NULL) {
+				*bound = node;
 			}
+		}
+
+		if (node->undo_recs == NULL) {
+			node->undo_recs = ib_vector_create(
+				ib_heap_allocator_create(node->heap),
+				sizeof(trx_purge_rec_t),
+				batch_size);
 		} else {
-			break;
+			ut_a(!ib_vector_is_empty(node->undo_recs));
 		}
 
-		thr = UT_LIST_GET_NEXT(thrs, thr);
+		ib_vector_push(node->undo_recs, &purge_rec);
+		n_recs++;
 
-		if (!(++i % n_purge_threads)) {
-			thr = UT_LIST_GET_FIRST(purge_sys.query->thrs);
+		if (n_pages_handled >= batch_size) {
+			break;
 		}
-
-		ut_a(thr != NULL);
 	}
 
 	ut_ad(purge_sys.head <= purge_sys.tail);
@@ -337,6 +337,7 @@ trx_rseg_mem_free(trx_rseg_t* rseg)
 	trx_undo_t*	next_undo;
 
 	mutex_free(&rseg->mutex);
+	os_event_destroy(rseg->commit_event);
 
 	/* There can't be any active transactions. */
 	ut_a(UT_LIST_GET_LEN(rseg->undo_list) == 0);
@@ -379,6 +380,8 @@ trx_rseg_mem_create(ulint id, fil_space_t* space, ulint page_no)
 		     ? LATCH_ID_REDO_RSEG : LATCH_ID_NOREDO_RSEG,
 		     &rseg->mutex);
 
+	rseg->commit_event = os_event_create(0);
+
 	UT_LIST_INIT(rseg->undo_list, &trx_undo_t::undo_list);
 	UT_LIST_INIT(rseg->old_insert_list, &trx_undo_t::undo_list);
 	UT_LIST_INIT(rseg->undo_cached, &trx_undo_t::undo_list);
@@ -221,6 +221,196 @@ trx_sys_t::create()
 	my_atomic_store32(&rseg_history_len, 0);
 
 	rw_trx_hash.init();
+
+	m_csn = 1;
+	m_csn_clean_id = 0;
+	m_csn_oldest_view = 1;
+	csn_log = srv_read_view_csn
+		? static_cast<trx_csn_slot_t*>(ut_zalloc_nokey(
+			TRX_SYS_CSN_LOG_SIZE * sizeof *csn_log))
+		: NULL;
+}
+
+/** Assign a commit sequence number to a transaction that is being
+committed in memory.
+@param[in,out]	trx	transaction */
+void
+trx_sys_t::csn_commit(trx_t* trx)
+{
+	ut_ad(csn_log);
+	ut_ad(trx->id);
+
+	trx_csn_slot_t*	slot = csn_slot(trx->id);
+
+	for (;;) {
+		int64	old_id = my_atomic_load64(
+			reinterpret_cast<int64*>(&slot->id));
+
+		if (trx_id_t(old_id) == TRX_ID_MAX) {
+			/* Another transaction is writing the slot. */
+			ut_delay(1);
+			continue;
+		}
+
+		if (old_id) {
+			trx_id_t	old_csn = trx_id_t(my_atomic_load64(
+				reinterpret_cast<int64*>(&slot->csn)));
+
+			if (old_csn == TRX_ID_MAX) {
+				ut_delay(1);
+				continue;
+			}
+
+			/* Views older than old_csn do not see old_id,
+			and they would no longer be able to tell. */
+			if (old_csn > trx_id_t(my_atomic_load64(
+				    reinterpret_cast<int64*>(
+					    &m_csn_oldest_view)))) {
+				csn_evict(trx, old_csn);
+			}
+		}
+
+		if (my_atomic_cas64(reinterpret_cast<int64*>(&slot->id),
+				    &old_id, int64(TRX_ID_MAX))) {
+			break;
+		}
+	}
+
+	my_atomic_store64(reinterpret_cast<int64*>(&slot->no),
+			  int64(trx->no));
+	my_atomic_store64(reinterpret_cast<int64*>(&slot->csn),
+			  int64(TRX_ID_MAX));
+	my_atomic_store64(reinterpret_cast<int64*>(&slot->id),
+			  int64(trx->id));
+
+	/* Readers that find the slot wait until the commit sequence
+	number has been assigned. A view that is created before the
+	increment will not see the transaction. */
+	trx_id_t	csn = trx_id_t(my_atomic_add64(
+		reinterpret_cast<int64*>(&m_csn), 1)) + 1;
+
+	my_atomic_store64(reinterpret_cast<int64*>(&slot->csn), int64(csn));
+}
+
+/** Attach the lists of invisible transactions to the open views that
+could still need a commit sequence number that is about to be evicted.
+@param[in,out]	caller_trx	used to get access to rw_trx_hash_pins
+@param[in]	csn		commit sequence number to be evicted */
+void
+trx_sys_t::csn_evict(trx_t* caller_trx, trx_id_t csn)
+{
+	mutex_enter(&mutex);
+
+	/* Views that will be opened later will see get_csn() or later. */
+	trx_id_t	oldest = get_csn();
+
+	for (trx_t* trx = UT_LIST_GET_FIRST(trx_list); trx != NULL;
+	     trx = UT_LIST_GET_NEXT(trx_list, trx)) {
+		ReadView&	view = trx->read_view;
+		int32_t		state;
+
+		while ((state = view.get_state())
+		       == READ_VIEW_STATE_SNAPSHOT) {
+			ut_delay(1);
+		}
+
+		if (state != READ_VIEW_STATE_OPEN || !view.csn()) {
+			continue;
+		}
+
+		if (view.csn() < csn && !view.get_csn_ids()) {
+			view.set_csn_ids(csn_collect(caller_trx, view));
+		}
+
+		if (view.csn() < oldest) {
+			oldest = view.csn();
+		}
+	}
+
+	my_atomic_store64(reinterpret_cast<int64*>(&m_csn_oldest_view),
+			  int64(oldest));
+
+	mutex_exit(&mutex);
+}
+
+/** Collect the transactions that a commit sequence number view does
+not see.
+@param[in,out]	caller_trx	used to get access to rw_trx_hash_pins
+@param[in]	view		open view with view.csn() != 0
+@return transactions for view.set_csn_ids() */
+csn_view_ids_t*
+trx_sys_t::csn_collect(trx_t* caller_trx, const ReadView& view)
+{
+	ut_ad(mutex_own(&mutex));
+	ut_ad(view.csn());
+
+	csn_view_ids_t*	csn_ids = UT_NEW_NOKEY(csn_view_ids_t());
+	snapshot_ids_arg	arg(&csn_ids->ids);
+
+	arg.m_id = view.low_limit_id();
+	arg.m_no = view.low_limit_id();
+
+	/* A transaction that commits meanwhile writes csn_log before
+	it is removed from rw_trx_hash. Its slot cannot be reused before
+	we are done, because csn_evict() would wait for our mutex. */
+	rw_trx_hash.iterate(caller_trx,
+			    reinterpret_cast<my_hash_walk_action>(copy_one_id),
+			    &arg);
+	csn_scan(view.csn(), view.low_limit_id(), &csn_ids->ids, &arg.m_no);
+
+	std::sort(csn_ids->ids.begin(), csn_ids->ids.end());
+	csn_ids->ids.erase(std::unique(csn_ids->ids.begin(),
+				       csn_ids->ids.end()),
+			   csn_ids->ids.end());
+	csn_ids->low_limit_no = arg.m_no;
+
+	return(csn_ids);
+}
+
+/** Collect the transactions in csn_log that were committed after a
+commit sequence number, or are being committed.
+@param[in]	csn		commit sequence number
+@param[in]	limit_id	ignore transaction identifiers not below this
+@param[in,out]	ids		transaction identifiers
+@param[in,out]	min_no		smallest serialisation number */
+void
+trx_sys_t::csn_scan(trx_id_t csn, trx_id_t limit_id, trx_ids_t* ids,
+		    trx_id_t* min_no)
+{
+	ut_ad(mutex_own(&mutex));
+
+	for (ulint i = 0; i < TRX_SYS_CSN_LOG_SIZE; i++) {
+		trx_csn_slot_t*	slot = &csn_log[i];
+		trx_id_t	id = trx_id_t(my_atomic_load64(
+			reinterpret_cast<int64*>(&slot->id)));
+
+		if (id == 0 || id >= limit_id) {
+			/* Unused, being written, or not relevant */
+			continue;
+		}
+
+		trx_id_t	no = trx_id_t(my_atomic_load64(
+			reinterpret_cast<int64*>(&slot->no)));
+		trx_id_t	slot_csn = trx_id_t(my_atomic_load64(
+			reinterpret_cast<int64*>(&slot->csn)));
+
+		if (trx_id_t(my_atomic_load64(reinterpret_cast<int64*>(
+				     &slot->id))) != id) {
+			/* The slot was reused for a transaction that
+			was in rw_trx_hash until now. */
+			continue;
+		}
+
+		if (slot_csn > csn) {
+			/* This includes TRX_ID_MAX: the commit sequence
+			number will be bigger than get_csn(). */
+			ids->push_back(id);
+
+			if (no < *min_no) {
+				*min_no = no;
+			}
+		}
+	}
 }
 
 /*****************************************************************//**
@@ -332,6 +522,9 @@ trx_sys_t::close()
 
 	rw_trx_hash.destroy();
 
+	ut_free(csn_log);
+	csn_log = NULL;
+
 	/* There can't be any active transactions. */
 
 	for (ulint i = 0; i < TRX_SYS_N_RSEGS; ++i) {
@@ -122,6 +122,10 @@ trx_init(
 
 	trx->no = TRX_ID_MAX;
 
+	trx->commit_next = NULL;
+
+	trx->commit_batch_lsn = 0;
+
 	trx->state = TRX_STATE_NOT_STARTED;
 
 	trx->is_recovered = false;
@@ -1056,11 +1060,106 @@ trx_serialise(trx_t* trx)
 	}
 }
 
+/** Assign the serialisation number of a committing transaction and add
+its undo logs to the history list of the rollback segment.
+@param[in,out]	trx	committing transaction with persistent changes
+@param[in,out]	mtr	mini-transaction */
+static
+void
+trx_write_undo_history(trx_t* trx, mtr_t* mtr)
+{
+	trx_rseg_t*		rseg = trx->rsegs.m_redo.rseg;
+	trx_undo_t*&		undo = trx->rsegs.m_redo.undo;
+	trx_undo_t*&		old_insert = trx->rsegs.m_redo.old_insert;
+
+	ut_ad(mutex_own(&rseg->mutex));
+	ut_ad(undo || old_insert);
+	ut_ad(!trx->read_only);
+	ut_ad(!undo || undo->rseg == rseg);
+	ut_ad(!old_insert || old_insert->rseg == rseg);
+
+	/* Assign the transaction serialisation number and add any
+	undo log to the purge queue. */
+	trx_serialise(trx);
+
+	/* It is not necessary to acquire trx->undo_mutex here because
+	only a single OS thread is allowed to commit this transaction.
+	The undo logs will be processed and purged later. */
+	if (UNIV_LIKELY_NULL(old_insert)) {
+		UT_LIST_REMOVE(rseg->old_insert_list, old_insert);
+		trx_purge_add_undo_to_history(trx, old_insert, mtr);
+	}
+	if (undo) {
+		UT_LIST_REMOVE(rseg->undo_list, undo);
+		trx_purge_add_undo_to_history(trx, undo, mtr);
+	}
+
+	MONITOR_INC(MONITOR_TRX_COMMIT_UNDO);
+
+	trx->mysql_log_file_name = NULL;
+}
+
+/** Wait until the mini-transaction that another thread used for writing
+the serialisation history of a transaction has been committed.
+@param[in,out]	trx	committing transaction */
+static
+void
+trx_commit_batch_wait(trx_t* trx)
+{
+	os_event_t	event = trx->rsegs.m_redo.rseg->commit_event;
+
+	for (;;) {
+		int64_t	sig_count = os_event_reset(event);
+
+		if (lsn_t(my_atomic_load64(reinterpret_cast<int64*>(
+				      &trx->commit_batch_lsn))) != LSN_MAX) {
+			return;
+		}
+
+		os_event_wait_low(event, sig_count);
+	}
+}
+
+/** Release the transactions whose serialisation history was written by
+trx_write_serialisation_history() on their behalf.
+@param[in,out]	followers	transactions linked by trx_t::commit_next
+@param[in]	lsn		commit lsn of the mini-transaction */
+static
+void
+trx_commit_batch_release(trx_t* followers, lsn_t lsn)
+{
+	ut_ad(lsn != 0);
+	ut_ad(lsn != LSN_MAX);
+
+	os_event_t	event = followers->rsegs.m_redo.rseg->commit_event;
+
+	do {
+		trx_t*	next = followers->commit_next;
+		followers->commit_next = NULL;
+		/* After this, the follower may resume and commit. */
+		my_atomic_store64(reinterpret_cast<int64*>(
+					  &followers->commit_batch_lsn),
+				  int64(lsn));
+		followers = next;
+	} while (followers != NULL);
+
+	os_event_set(event);
+}
+
 /****************************************************************//**
 Assign the transaction its history serialisation number and write the
-update UNDO log record to the assigned rollback segment. */
+update UNDO log record to the assigned rollback segment.
+
+Transactions that commit concurrently in the same rollback segment are
+written in batches. Each one enqueues itself in rseg->commit_queue
+before waiting for rseg->mutex, and the thread that acquires the mutex
+assigns the serialisation numbers of all queued transactions and links
+their undo logs to the history list in its own mini-transaction.
+@return the transactions that were written on behalf of other threads,
+to be passed to trx_commit_batch_release() after mtr_commit(); NULL if
+there were none */
 static
-void
+trx_t*
 trx_write_serialisation_history(
 /*============================*/
 	trx_t*		trx,	/*!< in/out: transaction */
@@ -1095,42 +1194,90 @@ trx_write_serialisation_history(
 	if (!rseg) {
 		ut_ad(!trx->rsegs.m_redo.undo);
 		ut_ad(!trx->rsegs.m_redo.old_insert);
-		return;
+		return(NULL);
 	}
 
-	trx_undo_t*& undo = trx->rsegs.m_redo.undo;
-	trx_undo_t*& old_insert = trx->rsegs.m_redo.old_insert;
+	if (!trx->rsegs.m_redo.undo && !trx->rsegs.m_redo.old_insert) {
+		return(NULL);
+	}
 
-	if (!undo && !old_insert) {
-		return;
+	ut_ad(!trx->commit_next);
+	ut_ad(!trx->commit_batch_lsn);
+
+	/* If the mini-transaction already contains changes (such as
+	the data dictionary changes of ALTER TABLE), they must be
+	committed atomically with the undo log state. Then we will not
+	let another thread write our history. */
+	const bool	may_follow = mtr->get_memo()->size() == 0
+		&& mtr->get_log()->size() == 0;
+
+	if (may_follow) {
+		void*	head = my_atomic_loadptr(reinterpret_cast<void**>(
+							 &rseg->commit_queue));
+		do {
+			trx->commit_next = static_cast<trx_t*>(head);
+		} while (!my_atomic_casptr(reinterpret_cast<void**>(
+						   &rseg->commit_queue),
+					   &head, trx));
+
+		DEBUG_SYNC_C("trx_commit_batch_enqueued");
 	}
 
-	ut_ad(!trx->read_only);
-	ut_ad(!undo || undo->rseg == rseg);
-	ut_ad(!old_insert || old_insert->rseg == rseg);
 	mutex_enter(&rseg->mutex);
 
-	/* Assign the transaction serialisation number and add any
-	undo log to the purge queue. */
-	trx_serialise(trx);
+	if (may_follow && my_atomic_load64(reinterpret_cast<int64*>(
+						   &trx->commit_batch_lsn))) {
+		/* Another thread wrote our history while we were
+		waiting for rseg->mutex. */
+		mutex_exit(&rseg->mutex);
+		trx_commit_batch_wait(trx);
+		return(NULL);
+	}
 
-	/* It is not necessary to acquire trx->undo_mutex here because
-	only a single OS thread is allowed to commit this transaction.
-	The undo logs will be processed and purged later. */
-	if (UNIV_LIKELY_NULL(old_insert)) {
-		UT_LIST_REMOVE(rseg->old_insert_list, old_insert);
-		trx_purge_add_undo_to_history(trx, old_insert, mtr);
+	DEBUG_SYNC_C("trx_commit_batch_leader");
+
+	if (!may_follow) {
+		trx_write_undo_history(trx, mtr);
 	}
-	if (undo) {
-		UT_LIST_REMOVE(rseg->undo_list, undo);
-		trx_purge_add_undo_to_history(trx, undo, mtr);
+
+	/* Detach the queue and reverse it, so that the transactions
+	will be serialised in the order in which they arrived. */
+	trx_t*	queue = static_cast<trx_t*>(
+		my_atomic_fasptr(reinterpret_cast<void**>(&rseg->commit_queue),
+				 NULL));
+	trx_t*	batch = NULL;
+
+	while (queue != NULL) {
+		trx_t*	next = queue->commit_next;
+		queue->commit_next = batch;
+		batch = queue;
+		queue = next;
 	}
 
-	mutex_exit(&rseg->mutex);
+	trx_t*	followers = NULL;
 
-	MONITOR_INC(MONITOR_TRX_COMMIT_UNDO);
+	while (batch != NULL) {
+		trx_t*	next = batch->commit_next;
+		batch->commit_next = NULL;
 
-	trx->mysql_log_file_name = NULL;
+		ut_ad(batch->rsegs.m_redo.rseg == rseg);
+		trx_write_undo_history(batch, mtr);
+
+		if (batch != trx) {
+			my_atomic_store64(reinterpret_cast<int64*>(
+						  &batch->commit_batch_lsn),
+					  int64(LSN_MAX));
+			batch->commit_next = followers;
+			followers = batch;
+			MONITOR_INC(MONITOR_TRX_COMMIT_BATCHED);
+		}
+
+		batch = next;
+	}
+
+	mutex_exit(&rseg->mutex);
+
+	return(followers);
 }
 
 /********************************************************************
@@ -1331,6 +1478,9 @@ trx_commit_in_memory(
 			/* For consistent snapshot, we need to remove current
 			transaction from rw_trx_hash before doing commit and
 			releasing locks. */
+			if (trx_sys.csn_enabled()) {
+				trx_sys.csn_commit(trx);
+			}
 			trx_sys.deregister_rw(trx);
 		}
 
@@ -1404,6 +1554,14 @@ trx_commit_in_memory(
 
 		lsn_t	lsn = mtr->commit_lsn();
 
+		if (lsn_t batch_lsn = trx->commit_batch_lsn) {
+			/* The undo log state was written in the
+			mini-transaction of another thread. */
+			ut_ad(lsn == 0);
+			lsn = batch_lsn;
+			trx->commit_batch_lsn = 0;
+		}
+
 		if (lsn == 0) {
 			/* Nothing to be done. */
 		} else if (trx->flush_log_later) {
@@ -1496,7 +1654,7 @@ void trx_commit_low(trx_t* trx, mtr_t* mtr)
 
 		mtr->set_sync();
 
-		trx_write_serialisation_history(trx, mtr);
+		trx_t*	followers = trx_write_serialisation_history(trx, mtr);
 
 		/* The following call commits the mini-transaction, making the
 		whole transaction committed in the file-based world, at this
@@ -1518,6 +1676,11 @@ void trx_commit_low(trx_t* trx, mtr_t* mtr)
 		/*--------------*/
 		mtr_commit(mtr);
 
+		if (followers != NULL) {
+			trx_commit_batch_release(followers,
+						 mtr->commit_lsn());
+		}
+
 		DBUG_EXECUTE_IF("ib_crash_during_trx_commit_in_mem",
 				if (trx->has_logged()) {
 					log_make_checkpoint_at(LSN_MAX, TRUE);